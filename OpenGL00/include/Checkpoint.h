@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Global.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Binary stream of a checkpoint file.
+	 *
+	 * Values are written in native byte order, checkpoints are meant for
+	 * resuming on the same kind of machine. Bulk float data is written with a
+	 * single call, optionally run-length compressed: a 32-bit word n is
+	 * followed by n literal values, or by one value repeated n & 0x7fffffff
+	 * times if the top bit is set. Calm water and untouched directions are
+	 * long runs of one value.
+	 */
+	class CheckpointWriter
+	{
+	public:
+		explicit CheckpointWriter(std::ostream& out) : m_out(out) {}
+
+		template <class T>
+		void put(T const& value) {
+			m_out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+		}
+		void putString(std::string const& s) {
+			put<std::uint32_t>(s.size());
+			m_out.write(s.data(), s.size());
+		}
+		void putFloats(Real const* data, std::size_t count, bool compress) {
+			put<std::uint8_t>(compress);
+			if (!compress) {
+				m_out.write(reinterpret_cast<char const*>(data), count * sizeof(Real));
+				return;
+			}
+
+			std::vector<std::uint32_t> packed;
+			std::size_t i = 0;
+			while (i < count) {
+				std::size_t run = 1;
+				while (i + run < count && run < 0x7fffffff && data[i + run] == data[i])
+					run++;
+				if (run >= 3) {
+					packed.push_back(0x80000000u | std::uint32_t(run));
+					packed.push_back(bits(data[i]));
+					i += run;
+					continue;
+				}
+				// literals up to the next run of three
+				std::size_t header = packed.size();
+				packed.push_back(0);
+				std::size_t n = 0;
+				while (i < count && n < 0x7fffffff &&
+					!(i + 2 < count && data[i] == data[i + 1] && data[i] == data[i + 2])) {
+					packed.push_back(bits(data[i]));
+					i++;
+					n++;
+				}
+				packed[header] = std::uint32_t(n);
+			}
+			put<std::uint64_t>(packed.size());
+			m_out.write(reinterpret_cast<char const*>(packed.data()), packed.size() * sizeof(std::uint32_t));
+		}
+
+		bool ok()const {
+			return bool(m_out);
+		}
+
+	private:
+		static std::uint32_t bits(Real value) {
+			static_assert(sizeof(Real) == sizeof(std::uint32_t), "Real has to be 32 bit");
+			std::uint32_t b;
+			std::memcpy(&b, &value, sizeof(b));
+			return b;
+		}
+
+		std::ostream& m_out;
+	};
+
+	/*
+	 * Reading counterpart of `CheckpointWriter`, check `ok()` after reading.
+	 *
+	 * Counts read from the file are checked against the bytes left in it
+	 * before anything is allocated for them, so a truncated or corrupt file
+	 * fails instead of asking for gigabytes.
+	 */
+	class CheckpointReader
+	{
+	public:
+		explicit CheckpointReader(std::istream& in) : m_in(in) {
+			auto pos = m_in.tellg();
+			if (pos != std::streampos(-1) && m_in.seekg(0, std::ios::end)) {
+				m_end = m_in.tellg();
+				m_in.seekg(pos);
+			}
+			m_in.clear(m_in.rdstate() & ~std::ios::eofbit);
+		}
+
+		template <class T>
+		T get() {
+			T value{};
+			m_in.read(reinterpret_cast<char*>(&value), sizeof(T));
+			return value;
+		}
+		std::string getString() {
+			std::uint32_t size = get<std::uint32_t>();
+			if (!m_in || size > (1u << 20) || !fits(size, 1)) {
+				m_in.setstate(std::ios::failbit);
+				return {};
+			}
+			std::string s(size, '\0');
+			m_in.read(&s[0], size);
+			return s;
+		}
+		// Reads `count` values straight into `data`
+		void getFloats(Real* data, std::size_t count) {
+			bool compressed = get<std::uint8_t>();
+			if (!compressed) {
+				if (fits(count, sizeof(Real)))
+					m_in.read(reinterpret_cast<char*>(data), count * sizeof(Real));
+				return;
+			}
+
+			// a literal costs one word and a header per run of them, a run two words
+			std::uint64_t words = get<std::uint64_t>();
+			if (!m_in || words > 2 * std::uint64_t(count) + 1 || !fits(words, sizeof(std::uint32_t))) {
+				m_in.setstate(std::ios::failbit);
+				return;
+			}
+			std::vector<std::uint32_t> packed(words);
+			m_in.read(reinterpret_cast<char*>(packed.data()), packed.size() * sizeof(std::uint32_t));
+
+			std::size_t i = 0, j = 0;
+			while (m_in && j < packed.size()) {
+				std::uint32_t word = packed[j++];
+				std::size_t n = word & 0x7fffffff;
+				bool run = word & 0x80000000u;
+				if (i + n > count || j + (run ? 1 : n) > packed.size())
+					break;
+				for (std::size_t k = 0; k < n; k++)
+					std::memcpy(&data[i + k], &packed[run ? j : j + k], sizeof(Real));
+				i += n;
+				j += run ? 1 : n;
+			}
+			if (i != count || j != packed.size())
+				m_in.setstate(std::ios::failbit);
+		}
+
+		/*
+		 * Whether `count` records of `bytes` bytes each are left in the
+		 * stream, fails the stream if not. Always true if the stream can not
+		 * tell its size.
+		 */
+		bool fits(std::uint64_t count, std::uint64_t bytes) {
+			if (!m_in)
+				return false;
+			if (m_end != std::streampos(-1)) {
+				std::uint64_t left = std::uint64_t(std::max<std::streamoff>(m_end - m_in.tellg(), 0));
+				if (bytes > 0 && count > left / bytes) {
+					m_in.setstate(std::ios::failbit);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool ok()const {
+			return bool(m_in);
+		}
+
+	private:
+		std::istream& m_in;
+		// end of the stream, -1 if unknown
+		std::streampos m_end = -1;
+	};
+}
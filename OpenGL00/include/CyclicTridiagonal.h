@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "Global.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Batched solver of periodic 1D diffusion systems.
+	 *
+	 * System j of the batch reads
+	 *
+	 *   -d_j x[i-1] + (1 + 2 d_j) x[i] - d_j x[i+1] = r[i],   i = 0..n-1
+	 *
+	 * with indices taken modulo n, i.e. an implicit diffusion step on a
+	 * ring. The cyclic corners are removed with Sherman-Morrison, which
+	 * leaves two solves with the same plain tridiagonal matrix. Since the
+	 * matrix only depends on d_j, everything but the right hand side is
+	 * factored once in `factor()`.
+	 *
+	 * The right hand sides are stored interleaved, entry i of system j at
+	 * x[j + i * count], so the inner loops of `solve()` run over the batch
+	 * with unit stride and vectorise.
+	 */
+	class CyclicTridiagonal
+	{
+	public:
+		/*
+		 * Factors `d.size()` systems of size `n`, d[j] >= 0 is the diffusion
+		 * number of system j. d[j] = 0 gives the identity.
+		 */
+		void factor(int n, std::vector<Real> const& d) {
+			assert(n >= 3);
+			const int m = d.size();
+			m_n = n;
+			m_count = m;
+			m_cp.assign(n * m, 0);
+			m_inv.assign(n * m, 0);
+			m_z.assign(n * m, 0);
+			m_d = d;
+			m_betaGamma.assign(m, 0);
+			m_zfactor.assign(m, 0);
+
+			for (int j = 0; j < m; j++) {
+				// gamma = -b, corners alpha = beta = -d
+				Real a = -d[j];
+				Real b = 1 + 2 * d[j];
+				Real gamma = -b;
+
+				// Thomas forward sweep of the matrix with corrected corners
+				auto diag = [&](int i) {
+					if (i == 0) return b - gamma;
+					if (i == n - 1) return b - a * a / gamma;
+					return b;
+				};
+				Real c = a;
+				Real inv = 1 / diag(0);
+				m_inv[j] = inv;
+				m_cp[j] = c * inv;
+				for (int i = 1; i < n; i++) {
+					inv = 1 / (diag(i) - a * m_cp[j + (i - 1) * m]);
+					m_inv[j + i * m] = inv;
+					m_cp[j + i * m] = c * inv;
+				}
+
+				// z solves the corrected system for u = (gamma, 0, ..., 0, alpha)
+				std::vector<Real> z(n);
+				for (int i = 0; i < n; i++) {
+					Real u = i == 0 ? gamma : (i == n - 1 ? a : 0);
+					Real prev = i == 0 ? 0 : z[i - 1];
+					z[i] = (u - a * prev) * m_inv[j + i * m];
+				}
+				for (int i = n - 2; i >= 0; i--)
+					z[i] -= m_cp[j + i * m] * z[i + 1];
+				for (int i = 0; i < n; i++)
+					m_z[j + i * m] = z[i];
+
+				m_betaGamma[j] = a / gamma;
+				m_zfactor[j] = 1 / (1 + z[0] + m_betaGamma[j] * z[n - 1]);
+			}
+		}
+
+		/*
+		 * Solves all systems in place, `x` holds n * count values interleaved
+		 * as described above.
+		 */
+		void solve(Real* x) const {
+			const int n = m_n;
+			const int m = m_count;
+			Real const* d = m_d.data();
+
+			// forward and backward sweep of the corrected system
+			for (int j = 0; j < m; j++)
+				x[j] *= m_inv[j];
+			for (int i = 1; i < n; i++) {
+				Real* xi = x + i * m;
+				Real const* xp = xi - m;
+				Real const* inv = m_inv.data() + i * m;
+				for (int j = 0; j < m; j++)
+					xi[j] = (xi[j] + d[j] * xp[j]) * inv[j];
+			}
+			for (int i = n - 2; i >= 0; i--) {
+				Real* xi = x + i * m;
+				Real const* xn = xi + m;
+				Real const* cp = m_cp.data() + i * m;
+				for (int j = 0; j < m; j++)
+					xi[j] -= cp[j] * xn[j];
+			}
+
+			// Sherman-Morrison correction, rows 0 and n-1 hold the factor's
+			// inputs and are updated last
+			Real* xl = x + (n - 1) * m;
+			Real const* bg = m_betaGamma.data();
+			Real const* zf = m_zfactor.data();
+			for (int i = 1; i < n - 1; i++) {
+				Real* xi = x + i * m;
+				Real const* z = m_z.data() + i * m;
+				for (int j = 0; j < m; j++)
+					xi[j] -= (x[j] + bg[j] * xl[j]) * zf[j] * z[j];
+			}
+			Real const* z0 = m_z.data();
+			Real const* zl = m_z.data() + (n - 1) * m;
+			for (int j = 0; j < m; j++) {
+				Real fact = (x[j] + bg[j] * xl[j]) * zf[j];
+				x[j] -= fact * z0[j];
+				xl[j] -= fact * zl[j];
+			}
+		}
+
+	private:
+		int m_n = 0;
+		int m_count = 0;
+		// diffusion numbers
+		std::vector<Real> m_d;
+		// Thomas coefficients c'_i and 1 / pivot_i
+		std::vector<Real> m_cp;
+		std::vector<Real> m_inv;
+		// Sherman-Morrison vector and scalars
+		std::vector<Real> m_z;
+		std::vector<Real> m_betaGamma;
+		std::vector<Real> m_zfactor;
+	};
+}
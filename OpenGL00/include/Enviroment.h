@@ -4,73 +4,144 @@
 
 #pragma once
 #include<vector> 
+#include <cmath>
+#include <iostream>
  std::vector<float> harbor_data = {126.188,125.188,124.188,123.188,122.188,121.188,120.188,119.188,118.188,117.188,116.188,115.188,114.188,113.188,112.188,111.188,110.188,109.188,108.188,107.188,106.188,105.188,104.188,103.188,102.188,101.188,100.188,99.1875,98.1875,97.1875,96.1875,95.1875,94.1875,93.1875,92.1875,91.1875,90.1875,89.1875,88.1875,87.1875,86.1875,85.1875,84.1875,83.1875,82.1875,81.1875,80.1875,79.1875,78.1875,77.1875,76.1875,75.1875,74.1875,73.1875,72.1875,71.1875,70.1875,69.1875,68.1875,67.1875,66.1875,65.1875,64.1875,63.1875,62.1875,61.1875,60.1875,59.1875,58.1875,57.1875,56.1875,55.1875,54.1875,53.1875,52.1875,51.1875,50.1875,49.1875,48.1875,47.1875,46.1875,45.1875,44.1875,43.1875,42.1875,41.1875,40.1875,39.1875,38.1875,37.1875,36.1875,35.1875,34.1875,33.1875,32.1875,31.1875,30.1875,29.1875,28.1875,27.1875,26.1875,25.1875,24.1875,23.1875,22.1875,21.1875,20.1875,19.1875,18.1875,17.1875,16.1875,15.1875,14.1875,13.1875,12.1875,11.1875,10.1875,9.1875,8.1875,7.1875,6.1875,5.1875,4.1875,3.1875,2.1875,1.1875,0.1875,-0.8125,-1.78973,-2.77545,-3.73591,-4.68417,-5.63367,-6.58152,-7.53144,-8.49103,-9.44764,-10.3961,-11.3173,-12.2457,-13.1844,-14.113,-15.0475,-15.9866,-16.9099,-17.8331,-18.7555,-19.6838,-20.6144,-21.5512,-22.4934,-23.4404,-24.3845,-25.3131,-26.2465,-27.1812,-28.1126,-29.0485,-29.9886,-30.9324,-31.8797,-32.8284,-33.7755,-34.71,-35.6481,-36.5894,-37.5338,-38.4729,-39.415,-40.3598,-41.3073,-42.2571,-43.2092,-44.1635,-45.1197,-46.0706,-47.0193,-47.9678,-48.9166,-49.8652,-50.8139,-51.7632,-52.7143,-53.6673,-54.6219,-55.5781,-56.5358,-57.495,-58.4555,-59.4174,-60.3805,-61.3447,-62.3101,-63.2745,-64.2391,-65.2048,-66.1714,-67.1391,-68.1077,-69.0772,-70.0474,-71.0175,-71.9877,-72.9578,-73.9253,-74.8913,-75.8581,-76.8258,-77.7943,-78.7636,-79.7336,-80.7044,-81.6759,-82.6481,-83.6209,-84.5943,-85.5684,-86.5431,-87.5183,-88.4941,-89.4704,-90.4472,-91.4246,-92.4024,-93.3807,-94.0706,-94.1329,-94.2026,-94.2829,-94.3736,-94.4749,-94.5866,-94.7085,-94.8357,-94.9734,-95.1171,-95.2708,-95.4346,-95.6087,-95.7928,-95.9866,-96.1876,-96.3985,-96.6159,-96.8407,-97.0754,-97.3183,-97.5697,-97.8307,-98.1012,-98.3811,-98.6681,-98.9603,-99.2617,-99.5723,-99.8904,-100.217,-100.553,-100.897,-101.249,-101.599,-101.955,-102.319,-102.69,-103.068,-103.454,-103.848,-104.245,-104.635,-105.032,-105.438,-105.851,-106.266,-106.689,-107.119,-107.557,-108.002,-108.449,-108.897,-109.346,-109.802,-110.266,-110.736,-111.21,-111.688,-112.172,-112.663,-113.159,-113.659,-114.166,-114.679,-115.199,-115.725,-116.258,-116.713,-117.132,-117.557,-117.99,-118.429,-118.875,-119.323,-119.778,-120.238,-120.706,-121.18,-121.66,-122.145,-122.633,-123.128,-123.628,-124.135,-124.647,-125.163,-125.685,-126.213,-126.746,-127.285,-127.829,-128.379,-128.934,-129.495,-130.061,-130.632,-131.208,-131.789,-132.372,-132.959,-133.552,-134.15,-134.751,-135.356,-135.966,-136.581,-137.2,-137.823,-138.451,-139.084,-139.72,-140.361,-141.006,-141.656,-142.309,-142.966,-143.627,-144.292,-144.961,-145.634,-146.311,-146.991,-147.675,-148.362,-149.053,-149.747,-150.445,-151.147,-151.851,-152.558,-153.266,-153.977,-154.691,-155.408,-156.128,-156.851,-157.578,-158.307,-159.039,-159.774,-160.512,-161.253,-161.997,-162.743,-163.492,-164.244,-164.998,-165.755,-166.515,-167.274,-168.037,-168.802,-169.569,-170.339,-171.111,-171.885,-172.662,-173.154,-173.459,-173.768,-174.083,-174.402,-174.725,-175.053,-175.387,-175.725,-176.069,-176.418,-176.769,-177.125,-177.485,-177.851,-178.221,126.189,125.189,124.189,123.189,122.189,121.189,120.189,119.189,118.189,117.189,116.189,115.189,114.189,113.189,112.189,111.189,110.189,109.189,108.189,107.189,106.189,105.189,104.189,103.189,102.189,101.189,100.189,99.1895,98.1895,97.1895,96.1895,95.1896,94.1896,93.1896,92.1896,91.1896,90.1897,89.1897,88.1897,87.1897,86.1898,85.1898,84.1898,83.1898,82.1899,81.1899,80.1899,79.19,78.19,77.19,76.1901,75.1901,74.1901,73.1902,72.1902,71.1902,70.1903,69.1903,68.1904,67.1904,66.1905,65.1905,64.1905,63.1906,62.1906,61.1907,60.1907,59.1908,58.1909,57.1909,56.191,55.191,54.1911,53.1912,52.1912,51.1913,50.1914,49.1915,48.1916,47.1916,46.1917,45.1918,44.1919,43.192,42.1921,41.1922,40.1924,39.1925,38.1926,37.1928,36.1929,35.1931,34.1932,33.1934,32.1936,31.1938,30.194,29.1942,28.1944,27.1947,26.195,25.1953,24.1956,23.1959,22.1963,21.1967,20.1972,19.1977,18.1982,17.1989,16.1996,15.2004,14.2013,13.2023,12.2035,11.2049,10.2067,9.20873,8.21132,7.21462,6.21899,5.22501,4.23388,3.2482,2.26385,1.27475,0.318689,-0.576222,-1.52197,-2.47251,-3.41927,-4.37009,-5.33598,-6.28552,-7.23382,-8.16744,-9.08747,-10.0228,-10.9568,-11.887,-12.8277,-13.7548,-14.6823,-15.6011,-16.5271,-17.4557,-18.3903,-19.3314,-20.2781,-21.2274,-22.1558,-23.0869,-24.0235,-24.9538,-25.8881,-26.8271,-27.7703,-28.7174,-29.6662,-30.6149,-31.5501,-32.4871,-33.4277,-34.3716,-35.3117,-36.2531,-37.1976,-38.145,-39.0949,-40.0473,-41.002,-41.9588,-42.9084,-43.8571,-44.8055,-45.7543,-46.7029,-47.6516,-48.6009,-49.5523,-50.5055,-51.4604,-52.4171,-53.3753,-54.3351,-55.2963,-56.2588,-57.2226,-58.1876,-59.1526,-60.1168,-61.0822,-62.0487,-63.0161,-63.9846,-64.9541,-65.9243,-66.8944,-67.8646,-68.8347,-69.803,-70.7687,-71.7353,-72.7028,-73.6713,-74.6405,-75.6105,-76.5813,-77.5529,-78.5252,-79.4981,-80.4718,-81.446,-82.4209,-83.3964,-84.3724,-85.349,-86.3261,-87.3038,-88.282,-89.2606,-90.2397,-91.2193,-92.1993,-93.0129,-93.0727,-93.135,-93.2055,-93.2866,-93.3783,-93.4807,-93.5936,-93.716,-93.8446,-93.9835,-94.1283,-94.2836,-94.4492,-94.625,-94.8111,-95.0062,-95.2092,-95.4224,-95.6406,-95.8677,-96.1048,-96.3495,-96.6034,-96.867,-97.1402,-97.4229,-97.7107,-98.0058,-98.3102,-98.6235,-98.9443,-99.2741,-99.6129,-99.9605,-100.312,-100.663,-101.022,-101.39,-101.763,-102.144,-102.534,-102.932,-103.323,-103.716,-104.117,-104.527,-104.94,-105.359,-105.785,-106.219,-106.661,-107.108,-107.555,-108.002,-108.455,-108.915,-109.382,-109.857,-110.331,-110.812,-111.3,-111.794,-112.292,-112.796,-113.307,-113.824,-114.348,-114.878,-115.389,-115.804,-116.226,-116.655,-117.091,-117.533,-117.981,-118.432,-118.889,-119.354,-119.824,-120.302,-120.786,-121.272,-121.763,-122.261,-122.765,-123.275,-123.79,-124.31,-124.835,-125.366,-125.903,-126.445,-126.993,-127.547,-128.105,-128.67,-129.239,-129.814,-130.394,-130.976,-131.562,-132.154,-132.75,-133.35,-133.955,-134.563,-135.177,-135.795,-136.418,-137.045,-137.676,-138.312,-138.953,-139.597,-140.246,-140.898,-141.555,-142.216,-142.88,-143.549,-144.221,-144.898,-145.578,-146.261,-146.948,-147.639,-148.333,-149.031,-149.732,-150.437,-151.144,-151.852,-152.563,-153.277,-153.994,-154.714,-155.438,-156.164,-156.894,-157.626,-158.361,-159.1,-159.841,-160.585,-161.331,-162.081,-162.833,-163.588,-164.345,-165.104,-165.865,-166.627,-167.393,-168.161,-168.931,-169.703,-170.478,-171.256,-171.9,-172.201,-172.507,-172.819,-173.135,-173.455,-173.78,-174.11,-174.445,-174.786,-175.131,-175.481,-175.834,-176.192,-176.554,-176.921,-177.294,126.198,125.198,124.198,123.198,122.198,121.198,120.198,119.199,118.199,117.199,116.199,115.199,114.199,113.199,112.199,111.199,110.199,109.2,108.2,107.2,106.2,105.2,104.2,103.2,102.2,101.201,100.201,99.2008,98.2009,97.2011,96.2012,95.2014,94.2015,93.2017,92.2018,91.202,90.2021,89.2023,88.2025,87.2026,86.2028,85.203,84.2032,83.2034,82.2036,81.2038,80.204,79.2042,78.2044,77.2046,76.2048,75.2051,74.2053,73.2055,72.2058,71.206,70.2063,69.2066,68.2069,67.2071,66.2074,65.2078,64.2081,63.2084,62.2087,61.2091,60.2094,59.2098,58.2102,57.2106,56.211,55.2114,54.2119,53.2123,52.2128,51.2133,50.2138,49.2143,48.2149,47.2155,46.2161,45.2167,44.2174,43.2181,42.2188,41.2195,40.2203,39.2212,38.2221,37.223,36.224,35.225,34.2261,33.2273,32.2285,31.2298,30.2312,29.2327,28.2343,27.236,26.2379,25.2399,24.242,23.2444,22.2469,21.2497,20.2528,19.2562,18.26,17.2641,16.2689,15.2742,14.2803,13.2872,12.2954,11.3049,10.3163,9.3301,8.34416,7.35697,6.37377,5.39676,4.43001,3.47873,2.53106,1.58114,0.637377,-0.257694,-1.21353,-2.17407,-3.12375,-4.07162,-5.01443,-5.93355,-6.86163,-7.79924,-8.72787,-9.6657,-10.604,-11.5248,-12.4507,-13.3705,-14.2987,-15.23,-16.1695,-17.1159,-18.0661,-18.9994,-19.9281,-20.8627,-21.796,-22.7281,-23.6657,-24.6083,-25.5552,-26.5039,-27.4526,-28.3908,-29.3264,-30.2661,-31.2095,-32.1506,-33.0914,-34.0355,-34.9827,-35.9328,-36.8855,-37.8406,-38.7972,-39.7461,-40.6948,-41.6432,-42.592,-43.5406,-44.4893,-45.4387,-46.3902,-47.3437,-48.2991,-49.2562,-50.215,-51.1754,-52.1373,-53.1006,-54.0652,-55.031,-55.9947,-56.9597,-57.9259,-58.8932,-59.8616,-60.831,-61.8012,-62.7713,-63.7415,-64.7117,-65.6807,-66.6461,-67.6125,-68.5799,-69.5482,-70.5174,-71.4874,-72.4583,-73.4299,-74.4023,-75.3754,-76.3492,-77.3237,-78.2988,-79.2745,-80.2509,-81.2278,-82.2052,-83.1833,-84.1618,-85.1408,-86.1203,-87.1002,-88.0807,-89.0613,-90.0419,-91.0224,-91.9648,-92.0144,-92.0748,-92.1372,-92.2084,-92.2903,-92.3831,-92.4865,-92.6007,-92.7237,-92.8537,-92.9934,-93.1398,-93.2967,-93.464,-93.6417,-93.8297,-94.0262,-94.2314,-94.4464,-94.6659,-94.8953,-95.1346,-95.3813,-95.6378,-95.9041,-96.18,-96.4655,-96.7543,-97.0523,-97.3596,-97.6754,-97.9992,-98.3322,-98.6742,-99.0251,-99.3755,-99.7289,-100.091,-100.461,-100.838,-101.222,-101.615,-102.014,-102.403,-102.799,-103.204,-103.617,-104.031,-104.453,-104.883,-105.321,-105.766,-106.213,-106.66,-107.11,-107.566,-108.03,-108.501,-108.975,-109.453,-109.938,-110.43,-110.926,-111.428,-111.936,-112.45,-112.972,-113.499,-114.033,-114.479,-114.897,-115.322,-115.754,-116.193,-116.639,-117.087,-117.542,-118.003,-118.471,-118.945,-119.426,-119.911,-120.4,-120.896,-121.397,-121.905,-122.418,-122.935,-123.458,-123.987,-124.522,-125.062,-125.608,-126.16,-126.717,-127.279,-127.847,-128.42,-128.999,-129.58,-130.165,-130.755,-131.351,-131.95,-132.553,-133.161,-133.773,-134.391,-135.012,-135.639,-136.269,-136.904,-137.544,-138.188,-138.836,-139.488,-140.144,-140.804,-141.468,-142.137,-142.809,-143.485,-144.164,-144.848,-145.535,-146.225,-146.919,-147.617,-148.318,-149.023,-149.73,-150.438,-151.148,-151.863,-152.58,-153.3,-154.024,-154.751,-155.48,-156.213,-156.949,-157.687,-158.429,-159.173,-159.92,-160.67,-161.422,-162.177,-162.935,-163.694,-164.455,-165.218,-165.984,-166.752,-167.523,-168.296,-169.072,-169.849,-170.63,-170.945,-171.248,-171.556,-171.87,-172.187,-172.508,-172.835,-173.167,-173.504,-173.847,-174.194,-174.545,-174.899,-175.259,-175.623,-175.993,-176.367,126.215,125.215,124.215,123.215,122.216,121.216,120.216,119.216,118.217,117.217,116.217,115.217,114.218,113.218,112.218,111.218,110.219,109.219,108.219,107.22,106.22,105.22,104.221,103.221,102.221,101.222,100.222,99.2222,98.2226,97.2229,96.2233,95.2237,94.2241,93.2245,92.2249,91.2253,90.2257,89.2261,88.2266,87.227,86.2275,85.2279,84.2284,83.2289,82.2294,81.2299,80.2305,79.231,78.2316,77.2321,76.2327,75.2333,74.2339,73.2346,72.2352,71.2359,70.2366,69.2373,68.238,67.2388,66.2395,65.2403,64.2412,63.242,62.2429,61.2438,60.2447,59.2457,58.2467,57.2477,56.2488,55.2499,54.251,53.2522,52.2535,51.2548,50.2561,49.2575,48.2589,47.2605,46.262,45.2637,44.2654,43.2672,42.2691,41.2711,40.2731,39.2753,38.2776,37.28,36.2826,35.2853,34.2881,33.2912,32.2944,31.2978,30.3014,29.3053,28.3095,27.3139,26.3187,25.3239,24.3295,23.3356,22.3422,21.3495,20.3575,19.3662,18.376,17.3868,16.399,15.4127,14.4265,13.4397,12.4549,11.4728,10.494,9.51972,8.55132,7.59111,6.6409,5.69265,4.74342,3.79556,2.84632,1.8802,0.929129,0.,-0.910014,-1.87292,-2.78739,-3.7023,-4.64523,-5.57232,-6.50391,-7.45114,-8.3708,-9.2976,-10.2174,-11.142,-12.0708,-13.0078,-13.9536,-14.9041,-15.8422,-16.7706,-17.7025,-18.6398,-19.5689,-20.5047,-21.4462,-22.3929,-23.3416,-24.2903,-25.2321,-26.166,-27.1046,-28.0475,-28.9899,-29.9297,-30.8734,-31.8204,-32.7706,-33.7237,-34.6794,-35.6349,-36.5839,-37.5325,-38.481,-39.4298,-40.3783,-41.3271,-42.2765,-43.2282,-44.182,-45.1379,-46.0956,-47.055,-48.0162,-48.9788,-49.943,-50.9085,-51.8728,-52.8373,-53.8032,-54.7703,-55.7385,-56.7079,-57.6781,-58.6482,-59.6184,-60.5886,-61.5585,-62.5236,-63.4898,-64.457,-65.4252,-66.3943,-67.3643,-68.3352,-69.3069,-70.2795,-71.2527,-72.2267,-73.2015,-74.1768,-75.1529,-76.1295,-77.1068,-78.0846,-79.063,-80.0419,-81.0213,-82.0012,-82.9816,-83.9623,-84.9429,-85.9234,-86.9041,-87.8846,-88.8652,-89.8458,-90.8268,-90.9658,-91.0159,-91.077,-91.1394,-91.2113,-91.2942,-91.388,-91.4925,-91.6079,-91.7316,-91.863,-92.0035,-92.1515,-92.31,-92.4792,-92.6588,-92.8488,-93.0466,-93.254,-93.4699,-93.6916,-93.9235,-94.1646,-94.4138,-94.673,-94.9419,-95.2207,-95.5073,-95.7987,-96.0996,-96.41,-96.7282,-97.0553,-97.3915,-97.7368,-98.0882,-98.439,-98.7958,-99.1614,-99.5337,-99.9135,-100.302,-100.699,-101.092,-101.484,-101.884,-102.292,-102.706,-103.124,-103.55,-103.983,-104.425,-104.872,-105.319,-105.766,-106.219,-106.679,-107.147,-107.621,-108.096,-108.578,-109.066,-109.562,-110.06,-110.565,-111.078,-111.596,-112.121,-112.653,-113.155,-113.569,-113.991,-114.419,-114.855,-115.297,-115.744,-116.196,-116.653,-117.118,-117.589,-118.067,-118.552,-119.038,-119.531,-120.03,-120.535,-121.046,-121.561,-122.082,-122.609,-123.141,-123.68,-124.224,-124.773,-125.329,-125.889,-126.456,-127.027,-127.604,-128.185,-128.769,-129.357,-129.951,-130.55,-131.152,-131.759,-132.37,-132.986,-133.607,-134.232,-134.862,-135.497,-136.135,-136.778,-137.426,-138.077,-138.733,-139.393,-140.056,-140.724,-141.396,-142.072,-142.751,-143.434,-144.121,-144.811,-145.505,-146.203,-146.904,-147.609,-148.316,-149.023,-149.734,-150.448,-151.166,-151.886,-152.61,-153.337,-154.067,-154.8,-155.536,-156.275,-157.016,-157.761,-158.508,-159.258,-160.011,-160.767,-161.525,-162.284,-163.046,-163.809,-164.576,-165.344,-166.115,-166.889,-167.665,-168.444,-169.224,-169.693,-169.992,-170.296,-170.606,-170.921,-171.239,-171.563,-171.891,-172.225,-172.564,-172.908,-173.258,-173.609,-173.966,-174.327,-174.694,-175.065,-175.441,126.24,125.24,124.24,123.241,122.241,121.242,120.242,119.243,118.243,117.244,116.244,115.245,114.245,113.246,112.246,111.247,110.247,109.248,108.248,107.249,106.249,105.25,104.251,103.251,102.252,101.252,100.253,99.2537,98.2544,97.2551,96.2558,95.2565,94.2572,93.258,92.2587,91.2595,90.2603,89.2611,88.262,87.2628,86.2637,85.2646,84.2655,83.2664,82.2674,81.2684,80.2694,79.2704,78.2715,77.2726,76.2737,75.2748,74.276,73.2772,72.2785,71.2797,70.281,69.2824,68.2838,67.2852,66.2867,65.2882,64.2898,63.2914,62.2931,61.2948,60.2966,59.2984,58.3003,57.3023,56.3043,55.3064,54.3086,53.3109,52.3132,51.3157,50.3182,49.3209,48.3237,47.3265,46.3295,45.3327,44.3359,43.3394,42.343,41.3467,40.3507,39.3548,38.3592,37.3638,36.3686,35.3737,34.3791,33.3849,32.391,31.3975,30.4044,29.4117,28.4196,27.4281,26.4372,25.447,24.4576,23.4691,22.4817,21.4954,20.5091,19.5224,18.5371,17.5535,16.5718,15.5925,14.6159,13.6428,12.6738,11.71,10.7529,9.80314,8.85473,7.90569,6.95746,6.00293,5.04085,4.09124,3.14307,2.18303,1.22793,0.3125,-0.559017,-1.48561,-2.41415,-3.34302,-4.28888,-5.22315,-6.13965,-7.06803,-7.98558,-8.91365,-9.84648,-10.7913,-11.7424,-12.6877,-13.6144,-14.5432,-15.48,-16.4109,-17.3441,-18.2843,-19.2306,-20.1794,-21.1281,-22.0745,-23.0062,-23.9434,-24.8854,-25.8295,-26.7682,-27.7113,-28.6581,-29.6085,-30.5621,-31.5185,-32.4726,-33.4216,-34.3703,-35.3187,-36.2675,-37.2161,-38.1648,-39.1143,-40.0662,-41.0204,-41.9768,-42.9351,-43.8953,-44.8573,-45.8209,-46.786,-47.751,-48.7151,-49.6806,-50.6474,-51.6155,-52.5848,-53.555,-54.5251,-55.4953,-56.4655,-57.4356,-58.4012,-59.3671,-60.3341,-61.3021,-62.2712,-63.2412,-64.2122,-65.184,-66.1567,-67.1301,-68.1044,-69.0793,-70.055,-71.0314,-72.0084,-72.986,-73.9642,-74.943,-75.9223,-76.9022,-77.8826,-78.8633,-79.8438,-80.8244,-81.8051,-82.7855,-83.7661,-84.7468,-85.7279,-86.7094,-87.6913,-88.6736,-89.6564,-89.9272,-89.9668,-90.0175,-90.0792,-90.1416,-90.2144,-90.2982,-90.3929,-90.4987,-90.6153,-90.7397,-90.8725,-91.0138,-91.1634,-91.3237,-91.4946,-91.6762,-91.8682,-92.0675,-92.277,-92.4939,-92.718,-92.9523,-93.1952,-93.447,-93.7088,-93.9806,-94.2621,-94.5497,-94.844,-95.148,-95.4613,-95.7822,-96.1124,-96.4519,-96.8006,-97.1515,-97.5038,-97.864,-98.2329,-98.6076,-98.9909,-99.3829,-99.7833,-100.171,-100.566,-100.97,-101.382,-101.796,-102.218,-102.647,-103.085,-103.53,-103.977,-104.424,-104.874,-105.33,-105.795,-106.266,-106.74,-107.219,-107.704,-108.197,-108.694,-109.196,-109.706,-110.222,-110.745,-111.274,-111.809,-112.244,-112.661,-113.086,-113.518,-113.957,-114.403,-114.851,-115.306,-115.767,-116.235,-116.71,-117.192,-117.677,-118.167,-118.663,-119.166,-119.674,-120.188,-120.707,-121.231,-121.762,-122.298,-122.84,-123.388,-123.941,-124.5,-125.064,-125.634,-126.21,-126.79,-127.372,-127.96,-128.552,-129.15,-129.751,-130.356,-130.967,-131.582,-132.202,-132.826,-133.455,-134.089,-134.727,-135.369,-136.016,-136.667,-137.322,-137.981,-138.645,-139.312,-139.983,-140.658,-141.338,-142.02,-142.707,-143.397,-144.091,-144.789,-145.49,-146.194,-146.901,-147.609,-148.32,-149.034,-149.752,-150.473,-151.196,-151.923,-152.654,-153.387,-154.123,-154.862,-155.604,-156.349,-157.097,-157.847,-158.6,-159.356,-160.115,-160.874,-161.636,-162.4,-163.167,-163.936,-164.708,-165.482,-166.259,-167.038,-167.818,-168.442,-168.738,-169.039,-169.345,-169.657,-169.973,-170.293,-170.618,-170.948,-171.284,-171.625,-171.971,-172.321,-172.674,-173.033,-173.396,-173.764,-174.138,-174.516,126.272,125.273,124.274,123.274,122.275,121.276,120.276,119.277,118.278,117.279,116.28,115.28,114.281,113.282,112.283,111.284,110.285,109.285,108.286,107.287,106.288,105.289,104.29,103.291,102.292,101.293,100.294,99.2953,98.2964,97.2975,96.2986,95.2998,94.301,93.3022,92.3034,91.3047,90.306,89.3073,88.3087,87.3101,86.3115,85.313,84.3144,83.316,82.3175,81.3191,80.3208,79.3224,78.3242,77.3259,76.3278,75.3296,74.3315,73.3335,72.3355,71.3376,70.3397,69.3419,68.3442,67.3465,66.3489,65.3514,64.3539,63.3565,62.3592,61.362,60.3649,59.3679,58.371,57.3742,56.3775,55.381,54.3845,53.3882,52.392,51.396,50.4002,49.4045,48.4089,47.4136,46.4185,45.4236,44.4289,43.4344,42.4403,41.4464,40.4528,39.4595,38.4666,37.474,36.4819,35.4902,34.4989,33.5082,32.5181,31.5286,30.5397,29.5517,28.5644,27.5781,26.5918,25.6052,24.6196,23.6352,22.6523,21.6708,20.6912,19.7136,18.7383,17.7658,16.7966,15.8311,14.8703,13.9149,12.9654,12.0169,11.068,10.1196,9.16025,8.20275,7.2535,6.30507,5.34,4.38837,3.44715,2.53106,1.62139,0.673146,-0.197642,-1.12673,-2.06912,-2.99087,-3.91412,-4.83679,-5.75713,-6.68604,-7.6291,-8.58096,-9.52669,-10.4571,-11.3855,-12.3188,-13.2549,-14.1842,-15.1225,-16.0683,-17.0171,-17.9658,-18.9144,-19.8472,-20.7824,-21.7235,-22.6696,-23.607,-24.5492,-25.4959,-26.4464,-27.4005,-28.3578,-29.3104,-30.2594,-31.208,-32.1564,-33.1052,-34.0538,-35.0025,-35.9521,-36.9043,-37.859,-38.8159,-39.775,-40.7361,-41.6989,-42.6635,-43.6295,-44.593,-45.558,-46.5246,-47.4925,-48.4617,-49.4319,-50.402,-51.3722,-52.3424,-53.3125,-54.2789,-55.2445,-56.2112,-57.1791,-58.1481,-59.1181,-60.0891,-61.0611,-62.0339,-63.0076,-63.9821,-64.9573,-65.9333,-66.91,-67.8874,-68.8655,-69.8441,-70.8234,-71.8032,-72.7836,-73.7642,-74.7448,-75.7253,-76.7061,-77.6865,-78.6671,-79.6478,-80.6289,-81.6105,-82.5925,-83.5749,-84.5578,-85.541,-86.5247,-87.5087,-88.493,-88.8989,-88.9277,-88.9678,-89.0191,-89.0815,-89.1439,-89.2175,-89.3022,-89.398,-89.5049,-89.6229,-89.7479,-89.8822,-90.0244,-90.1756,-90.3377,-90.5105,-90.694,-90.8876,-91.0888,-91.3006,-91.5184,-91.7449,-91.9817,-92.2265,-92.4809,-92.7455,-93.02,-93.3045,-93.593,-93.8903,-94.1973,-94.5131,-94.8372,-95.1708,-95.5136,-95.8653,-96.2152,-96.5699,-96.9336,-97.3047,-97.6829,-98.0699,-98.4655,-98.8607,-99.2513,-99.6504,-100.058,-100.471,-100.889,-101.314,-101.747,-102.189,-102.636,-103.083,-103.53,-103.983,-104.444,-104.912,-105.386,-105.861,-106.344,-106.833,-107.329,-107.828,-108.335,-108.848,-109.369,-109.895,-110.429,-110.921,-111.334,-111.755,-112.183,-112.619,-113.061,-113.508,-113.96,-114.418,-114.883,-115.354,-115.833,-116.318,-116.805,-117.298,-117.798,-118.304,-118.816,-119.333,-119.855,-120.383,-120.917,-121.457,-122.003,-122.554,-123.111,-123.674,-124.242,-124.816,-125.395,-125.977,-126.563,-127.154,-127.75,-128.35,-128.955,-129.564,-130.178,-130.797,-131.42,-132.049,-132.681,-133.318,-133.96,-134.606,-135.256,-135.911,-136.57,-137.233,-137.9,-138.571,-139.246,-139.924,-140.607,-141.293,-141.983,-142.677,-143.375,-144.076,-144.78,-145.487,-146.195,-146.906,-147.62,-148.338,-149.059,-149.783,-150.51,-151.24,-151.974,-152.71,-153.449,-154.192,-154.937,-155.685,-156.436,-157.19,-157.946,-158.705,-159.465,-160.227,-160.991,-161.759,-162.528,-163.301,-164.075,-164.853,-165.632,-166.413,-167.195,-167.486,-167.784,-168.086,-168.394,-168.708,-169.025,-169.346,-169.673,-170.006,-170.343,-170.686,-171.034,-171.385,-171.74,-172.1,-172.466,-172.836,-173.211,-173.592,126.313,125.314,124.315,123.316,122.317,121.318,120.319,119.32,118.321,117.322,116.324,115.325,114.326,113.327,112.328,111.33,110.331,109.332,108.334,107.335,106.336,105.338,104.339,103.341,102.342,101.344,100.345,99.3469,98.3485,97.3501,96.3518,95.3536,94.3553,93.3571,92.359,91.3608,90.3627,89.3647,88.3667,87.3688,86.3709,85.373,84.3752,83.3775,82.3798,81.3821,80.3845,79.387,78.3896,77.3922,76.3949,75.3976,74.4004,73.4033,72.4063,71.4094,70.4125,69.4158,68.4191,67.4226,66.4261,65.4297,64.4335,63.4374,62.4414,61.4455,60.4498,59.4542,58.4588,57.4635,56.4684,55.4734,54.4787,53.4841,52.4898,51.4956,50.5017,49.5081,48.5147,47.5216,46.5288,45.5363,44.5441,43.5523,42.5608,41.5698,40.5793,39.5891,38.5996,37.6105,36.6221,35.6343,34.6472,33.6608,32.6745,31.6879,30.7022,29.7174,28.7337,27.7511,26.7699,25.79,24.8118,23.8354,22.861,21.8889,20.9195,19.9531,18.9901,18.0312,17.077,16.1277,15.1791,14.2302,13.2818,12.3201,11.3649,10.4158,9.46127,8.50092,7.55035,6.60551,5.6796,4.75986,3.83447,2.90541,1.97642,1.03078,0.125,-0.75519,-1.68286,-2.60183,-3.5289,-4.46689,-5.42059,-6.36457,-7.30422,-8.22961,-9.15854,-10.0972,-11.0257,-11.961,-12.9061,-13.8549,-14.8035,-15.7521,-16.6894,-17.622,-18.5617,-19.5073,-20.446,-21.3872,-22.3336,-23.2844,-24.2392,-25.1975,-26.1481,-27.0971,-28.0458,-28.9941,-29.943,-30.8915,-31.8402,-32.7899,-33.7424,-34.6976,-35.6553,-36.6152,-37.5773,-38.5412,-39.507,-40.4711,-41.4356,-42.4018,-43.3695,-44.3386,-45.3087,-46.2789,-47.2491,-48.2193,-49.1894,-50.1568,-51.1219,-52.0884,-53.0561,-54.025,-54.995,-55.9661,-56.9382,-57.9112,-58.8851,-59.8599,-60.8355,-61.8118,-62.789,-63.7668,-64.7453,-65.7244,-66.7042,-67.6846,-68.6652,-69.6458,-70.6263,-71.6071,-72.5875,-73.5681,-74.5487,-75.5299,-76.5115,-77.4936,-78.4762,-79.4592,-80.4426,-81.4264,-82.4107,-83.3952,-84.3802,-85.3655,-86.3511,-87.3371,-87.8814,-87.8992,-87.9283,-87.9689,-88.0207,-88.0831,-88.1462,-88.2206,-88.3063,-88.4032,-88.5113,-88.6306,-88.7564,-88.8922,-89.0352,-89.1881,-89.3519,-89.5266,-89.7121,-89.9072,-90.1106,-90.3247,-90.5435,-90.7724,-91.0115,-91.2584,-91.5156,-91.7829,-92.0603,-92.3466,-92.6371,-92.9376,-93.2477,-93.566,-93.8934,-94.2303,-94.5766,-94.9278,-95.2791,-95.6373,-96.0045,-96.3779,-96.7598,-97.1504,-97.5497,-97.9391,-98.3333,-98.7361,-99.1473,-99.5615,-99.9825,-100.412,-100.849,-101.294,-101.741,-102.188,-102.638,-103.095,-103.559,-104.031,-104.505,-104.984,-105.471,-105.965,-106.462,-106.965,-107.476,-107.994,-108.518,-109.049,-109.586,-110.01,-110.426,-110.851,-111.282,-111.721,-112.167,-112.615,-113.07,-113.532,-114.,-114.476,-114.958,-115.444,-115.934,-116.431,-116.935,-117.445,-117.959,-118.479,-119.005,-119.537,-120.074,-120.618,-121.168,-121.723,-122.284,-122.851,-123.423,-124.,-124.581,-125.166,-125.756,-126.351,-126.95,-127.553,-128.161,-128.774,-129.392,-130.015,-130.642,-131.274,-131.91,-132.551,-133.197,-133.846,-134.5,-135.158,-135.821,-136.487,-137.158,-137.833,-138.511,-139.193,-139.88,-140.57,-141.263,-141.961,-142.662,-143.366,-144.073,-144.781,-145.492,-146.206,-146.924,-147.645,-148.369,-149.096,-149.827,-150.561,-151.297,-152.037,-152.78,-153.525,-154.274,-155.025,-155.779,-156.536,-157.295,-158.055,-158.817,-159.583,-160.35,-161.121,-161.893,-162.669,-163.446,-164.227,-165.008,-165.791,-166.238,-166.531,-166.83,-167.134,-167.444,-167.759,-168.077,-168.401,-168.73,-169.064,-169.403,-169.748,-170.098,-170.45,-170.807,-171.169,-171.536,-171.909,-172.286,-172.668,126.361,125.363,124.364,123.366,122.367,121.368,120.37,119.371,118.373,117.375,116.376,115.378,114.38,113.381,112.383,111.385,110.386,109.388,108.39,107.392,106.394,105.396,104.398,103.4,102.402,101.404,100.406,99.4085,98.4108,97.413,96.4154,95.4178,94.4202,93.4227,92.4252,91.4278,90.4305,89.4332,88.436,87.4388,86.4417,85.4447,84.4478,83.4509,82.4541,81.4574,80.4607,79.4641,78.4677,77.4713,76.475,75.4788,74.4827,73.4867,72.4909,71.4951,70.4995,69.504,68.5086,67.5133,66.5182,65.5233,64.5285,63.5339,62.5394,61.5451,60.551,59.5571,58.5634,57.57,56.5767,55.5837,54.591,53.5985,52.6063,51.6144,50.6229,49.6317,48.6408,47.6503,46.6602,45.6706,44.6814,43.6927,42.7045,41.7169,40.7299,39.7436,38.7573,37.7707,36.7848,35.7998,34.8156,33.8323,32.85,31.8689,30.8889,29.9103,28.9331,27.9576,26.9838,26.012,25.0425,24.0754,23.1111,22.1501,21.1926,20.2392,19.2899,18.3414,17.3925,16.4404,15.481,14.527,13.578,12.62,11.6626,10.7125,9.76641,8.8322,7.91409,6.9933,6.05831,5.12995,4.19076,3.25,2.32261,1.40451,0.475986,-0.380173,-1.30504,-2.26557,-3.20278,-4.15049,-5.07214,-6.00033,-6.9375,-7.87029,-8.80008,-9.74379,-10.6926,-11.6413,-12.5898,-13.5335,-14.4624,-15.4,-16.345,-17.2855,-18.2254,-19.1713,-20.1225,-21.0782,-22.0373,-22.9858,-23.9349,-24.8836,-25.8319,-26.7807,-27.7292,-28.678,-29.6277,-30.5806,-31.5365,-32.495,-33.456,-34.4191,-35.3843,-36.3495,-37.3133,-38.279,-39.2465,-40.2155,-41.1857,-42.1558,-43.126,-44.0962,-45.0663,-46.0348,-46.9995,-47.9656,-48.9331,-49.9019,-50.8719,-51.8431,-52.8153,-53.7885,-54.7627,-55.7378,-56.7138,-57.6906,-58.6682,-59.6465,-60.6255,-61.6052,-62.5856,-63.5662,-64.5468,-65.5273,-66.508,-67.4885,-68.4691,-69.4497,-70.4309,-71.4126,-72.3949,-73.3776,-74.3607,-75.3443,-76.3283,-77.3128,-78.2976,-79.2828,-80.2684,-81.2543,-82.2406,-83.2272,-84.2141,-85.2013,-86.1888,-86.875,-86.8815,-86.8995,-86.929,-86.9699,-87.0224,-87.0848,-87.1486,-87.2239,-87.3106,-87.4086,-87.5179,-87.6385,-87.765,-87.9023,-88.0463,-88.2009,-88.3665,-88.5432,-88.7307,-88.9272,-89.1329,-89.3483,-89.5691,-89.8005,-90.0415,-90.291,-90.5509,-90.8211,-91.1014,-91.3887,-91.6823,-91.9858,-92.299,-92.6201,-92.9508,-93.2911,-93.6408,-93.9916,-94.3444,-94.7061,-95.076,-95.4526,-95.8382,-96.2325,-96.6298,-97.019,-97.417,-97.8235,-98.237,-98.6534,-99.0783,-99.5113,-99.9525,-100.399,-100.847,-101.294,-101.747,-102.208,-102.677,-103.151,-103.627,-104.11,-104.6,-105.096,-105.597,-106.105,-106.62,-107.141,-107.67,-108.205,-108.687,-109.1,-109.52,-109.948,-110.383,-110.825,-111.272,-111.724,-112.182,-112.647,-113.12,-113.599,-114.084,-114.571,-115.066,-115.566,-116.074,-116.587,-117.104,-117.628,-118.157,-118.693,-119.235,-119.782,-120.335,-120.895,-121.459,-122.03,-122.606,-123.186,-123.769,-124.358,-124.951,-125.55,-126.152,-126.759,-127.371,-127.988,-128.609,-129.235,-129.867,-130.502,-131.142,-131.787,-132.436,-133.089,-133.747,-134.409,-135.075,-135.745,-136.42,-137.098,-137.78,-138.466,-139.156,-139.849,-140.546,-141.247,-141.952,-142.659,-143.367,-144.078,-144.792,-145.51,-146.231,-146.955,-147.683,-148.414,-149.147,-149.884,-150.624,-151.367,-152.113,-152.862,-153.614,-154.368,-155.126,-155.885,-156.645,-157.408,-158.174,-158.942,-159.713,-160.486,-161.262,-162.04,-162.821,-163.603,-164.386,-164.992,-165.281,-165.576,-165.877,-166.183,-166.494,-166.81,-167.13,-167.456,-167.786,-168.122,-168.464,-168.81,-169.161,-169.515,-169.874,-170.238,-170.608,-170.982,-171.361,-171.746,126.418,125.419,124.421,123.423,122.425,121.427,120.429,119.431,118.433,117.435,116.437,115.44,114.442,113.444,112.446,111.449,110.451,109.453,108.456,107.458,106.461,105.464,104.466,103.469,102.472,101.474,100.477,99.4802,98.4831,97.4862,96.4893,95.4924,94.4956,93.4989,92.5023,91.5057,90.5093,89.5129,88.5165,87.5203,86.5241,85.5281,84.5321,83.5362,82.5404,81.5448,80.5492,79.5538,78.5584,77.5632,76.5681,75.5731,74.5783,73.5836,72.5891,71.5947,70.6005,69.6064,68.6125,67.6188,66.6253,65.6319,64.6388,63.6459,62.6532,61.6608,60.6686,59.6766,58.685,57.6936,56.7025,55.7118,54.7213,53.7313,52.7416,51.7523,50.7634,49.775,48.787,47.7996,46.8127,45.8263,44.84,43.8534,42.8675,41.8823,40.8977,39.914,38.931,37.949,36.9679,35.9878,35.0089,34.0312,33.0549,32.08,31.1067,30.1351,29.1655,28.198,27.2328,26.2702,25.3106,24.3542,23.4014,22.4522,21.5036,20.5548,19.6,18.6423,17.6893,16.7403,15.7802,14.8245,13.8747,12.928,11.9899,11.0627,10.1443,9.217,8.28803,7.35272,6.408,5.47901,4.55736,3.6363,2.71138,1.78973,0.833854,-0.0625,-0.988212,-1.92942,-2.84632,-3.77543,-4.71202,-5.6406,-6.58152,-7.53041,-8.47906,-9.42756,-10.3758,-11.3042,-12.2387,-13.1828,-14.1258,-15.0637,-16.009,-16.9607,-17.9176,-18.8751,-19.8235,-20.7727,-21.7213,-22.6696,-23.6185,-24.567,-25.5157,-26.4656,-27.419,-28.3756,-29.3351,-30.2973,-31.2618,-32.2283,-33.1913,-34.1564,-35.1235,-36.0924,-37.0626,-38.0327,-39.0029,-39.9731,-40.9432,-41.913,-42.8772,-43.8429,-44.8102,-45.7789,-46.7488,-47.72,-48.6924,-49.6659,-50.6404,-51.6159,-52.5923,-53.5696,-54.5477,-55.5266,-56.5062,-57.4865,-58.4672,-59.4478,-60.4283,-61.409,-62.3895,-63.3701,-64.3507,-65.332,-66.3138,-67.2961,-68.279,-69.2623,-70.2461,-71.2304,-72.2151,-73.2002,-74.1857,-75.1716,-76.1578,-77.1444,-78.1314,-79.1187,-80.1063,-81.0942,-82.0824,-83.0708,-84.0596,-85.0486,-85.875,-85.875,-85.8816,-85.8998,-85.9296,-85.971,-86.0241,-86.0865,-86.1511,-86.2272,-86.3149,-86.414,-86.5246,-86.6462,-86.7738,-86.9124,-87.0576,-87.2139,-87.3815,-87.5601,-87.7498,-87.9477,-88.1557,-88.3721,-88.5953,-88.8292,-89.0721,-89.3244,-89.5871,-89.8602,-90.1435,-90.4317,-90.7284,-91.0351,-91.3508,-91.6753,-92.0094,-92.3531,-92.7047,-93.055,-93.411,-93.7763,-94.1486,-94.5288,-94.9181,-95.3163,-95.7076,-96.1006,-96.5023,-96.9127,-97.3268,-97.7471,-98.1759,-98.6129,-99.0578,-99.505,-99.9523,-100.402,-100.859,-101.324,-101.796,-102.27,-102.75,-103.237,-103.732,-104.23,-104.735,-105.247,-105.766,-106.291,-106.824,-107.363,-107.775,-108.191,-108.615,-109.046,-109.485,-109.931,-110.379,-110.834,-111.296,-111.765,-112.241,-112.724,-113.21,-113.701,-114.199,-114.704,-115.215,-115.73,-116.251,-116.779,-117.312,-117.852,-118.397,-118.949,-119.506,-120.069,-120.637,-121.212,-121.791,-122.373,-122.96,-123.553,-124.15,-124.751,-125.357,-125.968,-126.583,-127.204,-127.829,-128.459,-129.094,-129.734,-130.378,-131.026,-131.679,-132.336,-132.997,-133.663,-134.333,-135.007,-135.685,-136.366,-137.052,-137.742,-138.435,-139.132,-139.833,-140.538,-141.245,-141.952,-142.663,-143.378,-144.096,-144.817,-145.542,-146.269,-147.,-147.734,-148.472,-149.212,-149.955,-150.702,-151.451,-152.203,-152.958,-153.716,-154.475,-155.236,-155.999,-156.765,-157.534,-158.305,-159.079,-159.856,-160.635,-161.415,-162.198,-162.982,-163.746,-164.034,-164.325,-164.622,-164.924,-165.232,-165.545,-165.862,-166.184,-166.511,-166.844,-167.182,-167.525,-167.874,-168.225,-168.581,-168.942,-169.308,-169.68,-170.056,-170.438,-170.824,126.482,125.484,124.487,123.489,122.492,121.494,120.497,119.499,118.502,117.504,116.507,115.51,114.513,113.516,112.519,111.522,110.525,109.528,108.531,107.534,106.537,105.541,104.544,103.547,102.551,101.554,100.558,99.5618,98.5656,97.5695,96.5734,95.5775,94.5816,93.5858,92.5901,91.5945,90.599,89.6036,88.6083,87.6131,86.618,85.623,84.6282,83.6334,82.6388,81.6444,80.65,79.6558,78.6618,77.6679,76.6742,75.6806,74.6872,73.694,72.7009,71.7081,70.7155,69.723,68.7308,67.7388,66.7471,65.7556,64.7644,63.7734,62.7828,61.7924,60.8024,59.8126,58.8233,57.8343,56.8456,55.8574,54.8696,53.8823,52.8954,51.9091,50.9227,49.9362,48.9502,47.9648,46.98,45.9959,45.0125,44.0298,43.0479,42.0669,41.0868,40.1077,39.1296,38.1527,37.1769,36.2026,35.2296,34.2582,33.2885,32.3207,31.3548,30.3912,29.43,28.4715,27.5159,26.5636,25.6145,24.6659,23.7171,22.7604,21.8039,20.8515,19.9001,18.9411,17.9865,17.037,16.0898,15.1495,14.2173,13.295,12.3756,11.4435,10.5149,9.56883,8.63496,7.70678,6.78953,5.86102,4.94501,3.99316,3.05292,2.11487,1.1676,0.257694,-0.615554,-1.5625,-2.48825,-3.41927,-4.3683,-5.31691,-6.26529,-7.21462,-8.149,-9.078,-10.0205,-10.9676,-11.9023,-12.8468,-13.7991,-14.7577,-15.7129,-16.6613,-17.6105,-18.5591,-19.5073,-20.4562,-21.4047,-22.3534,-23.3034,-24.2575,-25.2151,-26.1759,-27.1395,-28.1056,-29.0695,-30.0339,-31.0006,-31.9693,-32.9395,-33.9096,-34.8798,-35.85,-36.8201,-37.7902,-38.755,-39.7203,-40.6873,-41.6558,-42.6257,-43.5971,-44.5696,-45.5434,-46.5183,-47.4942,-48.4712,-49.449,-50.4277,-51.4072,-52.3875,-53.3682,-54.3488,-55.3293,-56.31,-57.2904,-58.2711,-59.2517,-60.233,-61.2149,-62.1974,-63.1804,-64.164,-65.148,-66.1326,-67.1176,-68.103,-69.0888,-70.0751,-71.0617,-72.0487,-73.0361,-74.0238,-75.0118,-76.0001,-76.9887,-77.9777,-78.9669,-79.9563,-80.9461,-81.936,-82.9262,-83.9159,-84.875,-84.875,-84.875,-84.8817,-84.9001,-84.9302,-84.9722,-85.0258,-85.0882,-85.1536,-85.2306,-85.3193,-85.4196,-85.5315,-85.6538,-85.7828,-85.9223,-86.0691,-86.2273,-86.3967,-86.5774,-86.7692,-86.9687,-87.179,-87.3964,-87.6221,-87.8586,-88.1035,-88.3585,-88.6241,-88.9001,-89.186,-89.4756,-89.7755,-90.0855,-90.4038,-90.7316,-91.0692,-91.4165,-91.7676,-92.1194,-92.479,-92.8477,-93.2226,-93.6066,-93.9998,-94.3991,-94.787,-95.1837,-95.5893,-96.0026,-96.4184,-96.8427,-97.2754,-97.7164,-98.1634,-98.6106,-99.0581,-99.5113,-99.9725,-100.442,-100.916,-101.392,-101.876,-102.367,-102.864,-103.366,-103.875,-104.391,-104.914,-105.444,-105.981,-106.453,-106.865,-107.285,-107.712,-108.147,-108.589,-109.036,-109.488,-109.946,-110.412,-110.885,-111.364,-111.85,-112.338,-112.833,-113.335,-113.844,-114.357,-114.876,-115.401,-115.932,-116.469,-117.013,-117.562,-118.118,-118.679,-119.246,-119.818,-120.396,-120.978,-121.563,-122.154,-122.75,-123.35,-123.955,-124.564,-125.179,-125.799,-126.423,-127.052,-127.686,-128.325,-128.968,-129.616,-130.268,-130.925,-131.586,-132.251,-132.92,-133.594,-134.271,-134.953,-135.639,-136.328,-137.021,-137.718,-138.419,-139.123,-139.83,-140.538,-141.249,-141.964,-142.682,-143.403,-144.128,-144.856,-145.587,-146.321,-147.059,-147.8,-148.543,-149.29,-150.04,-150.792,-151.547,-152.306,-153.065,-153.826,-154.59,-155.357,-156.126,-156.898,-157.672,-158.449,-159.229,-160.01,-160.793,-161.578,-162.365,-162.789,-163.077,-163.37,-163.668,-163.972,-164.282,-164.597,-164.915,-165.239,-165.568,-165.902,-166.242,-166.587,-166.937,-167.29,-167.648,-168.011,-168.379,-168.753,-169.131,-169.515,-169.903,126.554,125.557,124.56,123.563,122.566,121.569,120.572,119.576,118.579,117.582,116.585,115.589,114.592,113.596,112.6,111.603,110.607,109.611,108.615,107.619,106.623,105.627,104.631,103.635,102.64,101.644,100.649,99.6534,98.6581,97.6629,96.6679,95.6729,94.678,93.6832,92.6886,91.6941,90.6996,89.7054,88.7112,87.7172,86.7233,85.7295,84.7359,83.7425,82.7492,81.756,80.7631,79.7703,78.7777,77.7853,76.7931,75.8011,74.8093,73.8177,72.8263,71.8352,70.8444,69.8538,68.8635,67.8734,66.8837,65.8942,64.9051,63.9164,62.9279,61.9399,60.9522,59.965,58.9782,57.9918,57.0055,56.019,55.0329,54.0474,53.0625,52.0781,51.0943,50.1111,49.1287,48.1469,47.1659,46.1858,45.2065,44.2281,43.2507,42.2744,41.2992,40.3252,39.3526,38.3813,37.4116,36.4434,35.4771,34.5127,33.5503,32.5903,31.6327,30.6778,29.7258,28.7768,27.8282,26.8794,25.9212,24.9657,24.0137,23.06,22.1024,21.1487,20.1992,19.2518,18.31,17.3748,16.4471,15.5285,14.6015,13.6727,12.7304,11.7925,10.8637,9.93829,9.01929,8.09176,7.15509,6.2105,5.27709,4.32877,3.38944,2.47251,1.54364,0.615554,-0.257694,-1.20708,-2.15512,-3.10305,-4.05287,-4.99062,-5.91905,-6.85822,-7.8075,-8.74151,-9.68448,-10.6379,-11.5991,-12.5507,-13.499,-14.4483,-15.397,-16.345,-17.294,-18.2424,-19.1912,-20.1414,-21.0962,-22.0551,-23.0174,-23.9828,-24.9481,-25.9116,-26.8777,-27.8462,-28.8164,-29.7865,-30.7567,-31.7269,-32.6971,-33.6671,-34.6331,-35.5978,-36.5644,-37.5327,-38.5026,-39.4741,-40.4469,-41.421,-42.3964,-43.3728,-44.3503,-45.3288,-46.3082,-47.2885,-48.2692,-49.2498,-50.2303,-51.211,-52.1914,-53.172,-54.1527,-55.1341,-56.1161,-57.0987,-58.082,-59.0658,-60.0501,-61.035,-62.0203,-63.0061,-63.9923,-64.979,-65.966,-66.9535,-67.9413,-68.9294,-69.9179,-70.9067,-71.8959,-72.8853,-73.875,-74.865,-75.8552,-76.8449,-77.8348,-78.825,-79.8147,-80.8046,-81.7948,-82.7846,-83.7745,-83.875,-83.875,-83.875,-83.8817,-83.9004,-83.9309,-83.9733,-84.0276,-84.09,-84.1562,-84.2341,-84.3238,-84.4253,-84.5385,-84.6615,-84.792,-84.9324,-85.081,-85.2409,-85.4123,-85.5951,-85.7886,-85.9901,-86.2028,-86.4212,-86.6494,-86.8884,-87.1355,-87.3934,-87.6618,-87.9409,-88.2278,-88.5206,-88.8236,-89.1367,-89.458,-89.7892,-90.1303,-90.4812,-90.8315,-91.1852,-91.5484,-91.9195,-92.2982,-92.686,-93.083,-93.4763,-93.868,-94.2686,-94.6781,-95.0921,-95.5118,-95.9401,-96.3769,-96.8218,-97.269,-97.7162,-98.1657,-98.623,-99.0883,-99.5615,-100.036,-100.516,-101.004,-101.499,-101.998,-102.504,-103.017,-103.538,-104.065,-104.6,-105.133,-105.541,-105.956,-106.38,-106.81,-107.249,-107.695,-108.143,-108.598,-109.06,-109.53,-110.006,-110.49,-110.976,-111.468,-111.968,-112.473,-112.985,-113.502,-114.024,-114.553,-115.088,-115.629,-116.177,-116.73,-117.289,-117.854,-118.425,-119.002,-119.582,-120.166,-120.756,-121.351,-121.95,-122.553,-123.162,-123.775,-124.394,-125.017,-125.646,-126.279,-126.917,-127.559,-128.206,-128.858,-129.514,-130.174,-130.839,-131.508,-132.181,-132.858,-133.54,-134.225,-134.914,-135.607,-136.304,-137.005,-137.709,-138.416,-139.124,-139.835,-140.55,-141.268,-141.989,-142.714,-143.442,-144.174,-144.909,-145.646,-146.387,-147.131,-147.878,-148.628,-149.381,-150.137,-150.896,-151.655,-152.417,-153.181,-153.948,-154.718,-155.491,-156.266,-157.043,-157.823,-158.605,-159.388,-160.174,-160.962,-161.544,-161.831,-162.12,-162.415,-162.715,-163.021,-163.332,-163.648,-163.968,-164.294,-164.625,-164.961,-165.303,-165.65,-166.001,-166.356,-166.716,-167.081,-167.451,-167.826,-168.207,-168.593,-168.98,126.634,125.638,124.641,123.645,122.649,121.652,120.656,119.66,118.664,117.668,116.672,115.676,114.681,113.685,112.69,111.694,110.699,109.703,108.708,107.713,106.718,105.723,104.728,103.733,102.738,101.744,100.749,99.755,98.7607,97.7666,96.7725,95.7787,94.7849,93.7913,92.7978,91.8044,90.8112,89.8182,88.8253,87.8325,86.8399,85.8475,84.8553,83.8633,82.8714,81.8798,80.8884,79.8971,78.9061,77.9153,76.9248,75.9345,74.9445,73.9547,72.9652,71.976,70.9872,69.9986,69.0103,68.0224,67.0349,66.0477,65.0609,64.0746,63.0882,62.1017,61.1157,60.1301,59.1449,58.1603,57.1763,56.1927,55.2098,54.2275,53.2459,52.265,51.2847,50.3053,49.3267,48.349,47.3722,46.3964,45.4216,44.448,43.4756,42.5044,41.5346,40.5663,39.5996,38.6345,37.6713,36.71,35.7509,34.794,33.8397,32.8881,31.939,30.9904,30.0401,29.0824,28.1276,27.176,26.2205,25.2639,24.3108,23.3615,22.4139,21.4711,20.5337,19.6025,18.6784,17.7597,16.8286,15.8922,14.952,14.0201,13.0918,12.1715,11.2462,10.3172,9.37125,8.43773,7.49088,6.54701,5.62257,4.70248,3.7604,2.83188,1.89778,0.951972,0.,-0.894864,-1.83818,-2.76699,-3.69596,-4.64565,-5.58248,-6.5222,-7.47757,-8.43935,-9.38853,-10.3367,-11.2862,-12.2348,-13.1828,-14.1318,-15.0801,-16.0289,-16.9794,-17.9353,-18.8958,-19.8602,-20.8275,-21.7896,-22.7549,-23.7231,-24.6933,-25.6635,-26.6337,-27.6039,-28.574,-29.5441,-30.5115,-31.4754,-32.4415,-33.4096,-34.3795,-35.3511,-36.3243,-37.2988,-38.2747,-39.2518,-40.23,-41.2093,-42.1895,-43.1702,-44.1508,-45.1312,-46.112,-47.0924,-48.073,-49.0537,-50.0351,-51.0173,-52.0002,-52.9836,-53.9677,-54.9524,-55.9376,-56.9233,-57.9095,-58.8962,-59.8834,-60.8709,-61.8588,-62.8472,-63.8358,-64.8249,-65.8143,-66.8039,-67.7939,-68.7841,-69.7738,-70.7637,-71.754,-72.7437,-73.7336,-74.7238,-75.7135,-76.7034,-77.6936,-78.684,-79.6746,-80.6654,-81.6565,-82.6478,-82.8818,-82.875,-82.875,-82.875,-82.8818,-82.9007,-82.9316,-82.9745,-83.0295,-83.0919,-83.1588,-83.2377,-83.3285,-83.4312,-83.5457,-83.6694,-83.8015,-83.9428,-84.0931,-84.2549,-84.4283,-84.6132,-84.8082,-85.0121,-85.2269,-85.4466,-85.6774,-85.9184,-86.1683,-86.429,-86.7005,-86.9826,-87.2705,-87.5665,-87.8729,-88.1886,-88.5133,-88.8481,-89.1928,-89.5442,-89.895,-90.2524,-90.6193,-90.9929,-91.3753,-91.7671,-92.1681,-92.5551,-92.9506,-93.3552,-93.7683,-94.1833,-94.6071,-95.0395,-95.4804,-95.9273,-96.3745,-96.822,-97.2754,-97.7369,-98.2064,-98.6806,-99.1576,-99.6424,-100.135,-100.632,-101.135,-101.645,-102.163,-102.688,-103.219,-103.758,-104.219,-104.63,-105.049,-105.476,-105.911,-106.353,-106.8,-107.252,-107.71,-108.177,-108.65,-109.13,-109.616,-110.105,-110.601,-111.104,-111.614,-112.128,-112.648,-113.175,-113.707,-114.246,-114.792,-115.343,-115.9,-116.464,-117.033,-117.607,-118.188,-118.77,-119.358,-119.951,-120.55,-121.152,-121.759,-122.372,-122.989,-123.612,-124.239,-124.871,-125.508,-126.15,-126.796,-127.447,-128.103,-128.763,-129.427,-130.095,-130.768,-131.445,-132.126,-132.811,-133.5,-134.193,-134.89,-135.591,-136.295,-137.002,-137.71,-138.421,-139.136,-139.854,-140.576,-141.301,-142.029,-142.761,-143.496,-144.234,-144.975,-145.719,-146.467,-147.217,-147.97,-148.727,-149.486,-150.245,-151.007,-151.772,-152.54,-153.31,-154.083,-154.859,-155.637,-156.418,-157.199,-157.984,-158.77,-159.559,-160.303,-160.586,-160.873,-161.164,-161.46,-161.762,-162.07,-162.383,-162.7,-163.022,-163.349,-163.682,-164.021,-164.364,-164.714,-165.065,-165.422,-165.784,-166.151,-166.524,-166.901,-167.284,-167.671,-167.996,126.722,125.726,124.73,123.735,122.739,121.744,120.748,119.753,118.758,117.763,116.768,115.773,114.778,113.783,112.788,111.794,110.799,109.805,108.81,107.816,106.822,105.828,104.834,103.84,102.847,101.853,100.86,99.8664,98.8733,97.8803,96.8874,95.8947,94.9022,93.9098,92.9176,91.9255,90.9336,89.9419,88.9504,87.9591,86.968,85.977,84.9863,83.9958,83.0056,82.0156,81.0258,80.0362,79.047,78.058,77.0693,76.0809,75.0928,74.105,73.1175,72.1304,71.1437,70.1573,69.171,68.1845,67.1984,66.2127,65.2275,64.2427,63.2584,62.2746,61.2913,60.3086,59.3264,58.3449,57.364,56.3837,55.4042,54.4254,53.4474,52.4702,51.4939,50.5186,49.5442,48.5708,47.5986,46.6275,45.6577,44.6892,43.7221,42.7566,41.7926,40.8304,39.8701,38.9118,37.9556,37.0017,36.0503,35.1013,34.1527,33.2007,32.2438,31.2895,30.3383,29.3814,28.4256,27.473,26.5237,25.576,24.6325,23.6935,22.7598,21.8319,20.9107,19.9863,19.0542,18.1125,17.1774,16.2487,15.3222,14.4039,13.476,12.5328,11.5951,10.6531,9.70764,8.7743,7.85737,6.92031,5.99088,5.0598,4.11172,3.16228,2.21501,1.26553,0.336573,-0.534,-1.48561,-2.43108,-3.35992,-4.32019,-5.27709,-6.22652,-7.17444,-8.12428,-9.07284,-10.0205,-10.9696,-11.9179,-12.8667,-13.8176,-14.775,-15.7377,-16.7048,-17.6681,-18.6322,-19.6,-20.5702,-21.5404,-22.5106,-23.4808,-24.4509,-25.421,-26.3904,-27.3533,-28.3188,-29.2866,-30.2565,-31.2282,-32.2018,-33.1768,-34.1534,-35.1312,-36.1103,-37.0905,-38.0712,-39.0517,-40.0322,-41.0131,-41.9934,-42.974,-43.9547,-44.9362,-45.9186,-46.9017,-47.8854,-48.8699,-49.8549,-50.8406,-51.8268,-52.8135,-53.8007,-54.7884,-55.7765,-56.765,-57.7539,-58.7432,-59.7329,-60.7229,-61.7131,-62.7027,-63.6927,-64.6829,-65.6726,-66.6625,-67.6527,-68.6425,-69.6323,-70.6225,-71.6129,-72.6036,-73.5946,-74.5858,-75.5772,-76.5689,-77.5607,-78.5528,-79.545,-80.5375,-81.5298,-81.7827,-81.8819,-81.875,-81.875,-81.875,-81.8819,-81.901,-81.9323,-81.9757,-82.0314,-82.0937,-82.1615,-82.2413,-82.3332,-82.4371,-82.5531,-82.6775,-82.8112,-82.9534,-83.1055,-83.2693,-83.4447,-83.6317,-83.8283,-84.0345,-84.2504,-84.4726,-84.7061,-84.9491,-85.2018,-85.4655,-85.74,-86.0253,-86.3142,-86.6135,-86.9232,-87.2416,-87.5698,-87.9082,-88.2566,-88.6075,-88.9599,-89.321,-89.6909,-90.0678,-90.4541,-90.8499,-91.2452,-91.6355,-92.035,-92.4436,-92.8574,-93.2765,-93.7043,-94.1409,-94.5857,-95.0329,-95.4801,-95.9297,-96.3872,-96.853,-97.3268,-97.8007,-98.282,-98.7711,-99.2665,-99.7665,-100.274,-100.789,-101.311,-101.84,-102.376,-102.9,-103.306,-103.721,-104.144,-104.575,-105.013,-105.459,-105.907,-106.362,-106.825,-107.295,-107.772,-108.256,-108.743,-109.236,-109.736,-110.243,-110.756,-111.273,-111.797,-112.328,-112.864,-113.407,-113.957,-114.512,-115.073,-115.641,-116.214,-116.793,-117.374,-117.961,-118.553,-119.15,-119.751,-120.357,-120.968,-121.585,-122.206,-122.832,-123.464,-124.1,-124.741,-125.387,-126.037,-126.692,-127.351,-128.015,-128.683,-129.355,-130.032,-130.713,-131.398,-132.086,-132.779,-133.476,-134.176,-134.881,-135.588,-136.296,-137.007,-137.722,-138.44,-139.162,-139.887,-140.616,-141.347,-142.083,-142.821,-143.563,-144.307,-145.055,-145.806,-146.56,-147.316,-148.075,-148.835,-149.598,-150.364,-151.132,-151.903,-152.676,-153.453,-154.231,-155.012,-155.794,-156.579,-157.366,-158.156,-158.948,-159.343,-159.628,-159.916,-160.208,-160.506,-160.81,-161.119,-161.434,-161.753,-162.076,-162.406,-162.741,-163.081,-163.427,-163.777,-164.131,-164.489,-164.853,-165.222,-165.597,-165.977,-166.361,-166.751,-167.012,126.817,125.822,124.828,123.833,122.838,121.843,120.849,119.854,118.86,117.866,116.871,115.877,114.883,113.889,112.896,111.902,110.908,109.915,108.922,107.928,106.935,105.942,104.95,103.957,102.964,101.972,100.98,99.9878,98.9958,98.0041,97.0125,96.0211,95.0299,94.0388,93.048,92.0573,91.0669,90.0766,89.0866,88.0968,87.1073,86.1179,85.1289,84.1401,83.1515,82.1633,81.1753,80.1876,79.2002,78.2132,77.2265,76.2401,75.2537,74.2673,73.2811,72.2954,71.3101,70.3251,69.3406,68.3566,67.373,66.3899,65.4074,64.4253,63.4439,62.463,61.4827,60.5031,59.5242,58.5459,57.5684,56.5917,55.6159,54.6409,53.6668,52.6937,51.7216,50.7506,49.7808,48.8121,47.8448,46.8788,45.9143,44.9514,43.9901,43.0305,42.0729,41.1172,40.1637,39.2126,38.2636,37.315,36.3615,35.4053,34.4516,33.5002,32.5425,31.5874,30.6352,29.686,28.7382,27.794,26.8539,25.9183,24.9877,24.0626,23.1437,22.2138,21.2735,20.3362,19.4052,18.4769,17.554,16.6313,15.6946,14.7545,13.8153,12.8691,11.9316,11.0051,10.0817,9.14552,8.21703,7.27367,6.32456,5.37645,4.42737,3.4821,2.55334,1.62259,0.673146,-0.197642,-1.1676,-2.11487,-3.06505,-4.01219,-4.96275,-5.91113,-6.85822,-7.8075,-8.75558,-9.70442,-10.656,-11.6158,-12.5818,-13.5475,-14.5098,-15.4769,-16.4471,-17.4173,-18.3875,-19.3578,-20.3279,-21.2979,-22.268,-23.2315,-24.1961,-25.1635,-26.1334,-27.1054,-28.0794,-29.0552,-30.0325,-31.0113,-31.9915,-32.9722,-33.9527,-34.9332,-35.9141,-36.8944,-37.875,-38.8557,-39.8374,-40.8199,-41.8033,-42.7874,-43.7723,-44.7579,-45.744,-46.7308,-47.7181,-48.7059,-49.6942,-50.683,-51.6722,-52.6618,-53.6518,-54.6421,-55.6317,-56.6216,-57.6119,-58.6015,-59.5914,-60.5817,-61.5714,-62.5613,-63.5515,-64.542,-65.5327,-66.5238,-67.5151,-68.5067,-69.4985,-70.4905,-71.4828,-72.4753,-73.4676,-74.4596,-75.4519,-76.4443,-77.437,-78.4298,-79.4228,-80.416,-80.6158,-80.8003,-80.882,-80.875,-80.875,-80.875,-80.882,-80.9013,-80.933,-80.977,-81.0333,-81.0957,-81.1642,-81.245,-81.3381,-81.4433,-81.5606,-81.6858,-81.8211,-81.9643,-82.1182,-82.2839,-82.4615,-82.6507,-82.8488,-83.0575,-83.2744,-83.4993,-83.7354,-83.9805,-84.2361,-84.5028,-84.7804,-85.067,-85.3589,-85.6615,-85.9744,-86.2959,-86.6277,-86.9697,-87.3215,-87.6712,-88.0262,-88.3911,-88.7635,-89.1443,-89.5346,-89.9344,-90.3234,-90.7177,-91.1212,-91.5338,-91.9484,-92.3715,-92.8036,-93.2443,-93.6913,-94.1385,-94.5859,-95.0395,-95.5013,-95.9713,-96.4455,-96.9232,-97.4088,-97.9023,-98.3996,-98.9039,-99.4157,-99.9348,-100.461,-100.995,-101.536,-101.985,-102.396,-102.814,-103.241,-103.675,-104.117,-104.564,-105.016,-105.475,-105.941,-106.415,-106.896,-107.382,-107.872,-108.369,-108.873,-109.384,-109.899,-110.421,-110.949,-111.483,-112.024,-112.571,-113.124,-113.684,-114.249,-114.821,-115.398,-115.979,-116.564,-117.154,-117.75,-118.35,-118.955,-119.565,-120.18,-120.801,-121.426,-122.057,-122.692,-123.332,-123.977,-124.627,-125.281,-125.94,-126.603,-127.271,-127.943,-128.619,-129.299,-129.984,-130.673,-131.365,-132.062,-132.762,-133.467,-134.174,-134.881,-135.593,-136.307,-137.026,-137.748,-138.473,-139.202,-139.934,-140.67,-141.408,-142.15,-142.895,-143.644,-144.395,-145.149,-145.906,-146.665,-147.426,-148.189,-148.955,-149.724,-150.495,-151.27,-152.046,-152.826,-153.607,-154.39,-155.175,-155.963,-156.753,-157.546,-158.103,-158.384,-158.67,-158.959,-159.253,-159.553,-159.858,-160.17,-160.486,-160.806,-161.132,-161.463,-161.8,-162.142,-162.49,-162.841,-163.196,-163.557,-163.923,-164.295,-164.671,-165.053,-165.44,-165.832,-166.029,126.921,125.927,124.933,123.939,122.945,121.951,120.957,119.964,118.97,117.977,116.984,115.991,114.998,114.005,113.012,112.019,111.027,110.034,109.042,108.05,107.058,106.066,105.075,104.083,103.092,102.101,101.11,100.119,99.1283,98.1379,97.1477,96.1577,95.1679,94.1783,93.1889,92.1998,91.2109,90.2222,89.2338,88.2457,87.2578,86.2702,85.2829,84.2959,83.3092,82.3228,81.3365,80.35,79.3639,78.3781,77.3927,76.4076,75.423,74.4387,73.4549,72.4715,71.4886,70.5062,69.5243,68.5429,67.562,66.5817,65.602,64.6229,63.6445,62.6668,61.6897,60.7135,59.738,58.7633,57.7895,56.8166,55.8447,54.8737,53.9038,52.9351,51.9675,51.0012,50.0362,49.0727,48.1105,47.15,46.1912,45.2341,44.2789,43.3258,42.3748,41.4259,40.4772,39.5226,38.567,37.6136,36.6608,35.7039,34.7493,33.7974,32.8483,31.9004,30.9557,30.0147,29.0776,28.1449,27.2169,26.2942,25.3713,24.4349,23.496,22.5624,21.6338,20.7068,19.7869,18.8566,17.9149,16.9776,16.0309,15.091,14.1594,13.2378,12.3041,11.375,10.4358,9.48683,8.53852,7.58957,6.64267,5.71183,4.7836,3.83447,2.88991,1.93851,0.988212,0.0625,-0.850092,-1.80386,-2.75071,-3.69596,-4.64565,-5.59331,-6.54223,-7.49505,-8.45877,-9.42901,-10.388,-11.3539,-12.3241,-13.2943,-14.2645,-15.2348,-16.2049,-17.1749,-18.1449,-19.1103,-20.0737,-21.0405,-22.0103,-22.9827,-23.9573,-24.934,-25.9124,-26.8924,-27.8732,-28.8538,-29.8342,-30.8151,-31.7954,-32.776,-33.7567,-34.7385,-35.7214,-36.7051,-37.6897,-38.6751,-39.6613,-40.6481,-41.6355,-42.6235,-43.6121,-44.6012,-45.5907,-46.5807,-47.5711,-48.5606,-49.5506,-50.5409,-51.5305,-52.5204,-53.5107,-54.5004,-55.4902,-56.4804,-57.471,-58.4619,-59.453,-60.4445,-61.4363,-62.4283,-63.4205,-64.413,-65.4054,-66.3974,-67.3896,-68.3821,-69.3748,-70.3677,-71.3608,-72.3541,-73.3476,-74.3412,-75.335,-76.329,-77.3231,-78.3174,-79.294,-79.457,-79.6322,-79.8166,-79.8821,-79.875,-79.875,-79.875,-79.8821,-79.9016,-79.9337,-79.9782,-80.0353,-80.0976,-80.1671,-80.2489,-80.3431,-80.4496,-80.5683,-80.6943,-80.8313,-80.9754,-81.1312,-81.299,-81.4786,-81.6702,-81.8699,-82.0811,-82.299,-82.5265,-82.7653,-83.0126,-83.2712,-83.541,-83.8218,-84.1094,-84.4046,-84.7106,-85.0263,-85.3513,-85.6868,-86.0326,-86.3838,-86.7352,-87.094,-87.4626,-87.8377,-88.2225,-88.6169,-89.0144,-89.4033,-89.8016,-90.2092,-90.6228,-91.0412,-91.4686,-91.9048,-92.3496,-92.7968,-93.2441,-93.6936,-94.1515,-94.6177,-95.0919,-95.566,-96.048,-96.5381,-97.034,-97.5351,-98.0439,-98.5601,-99.0838,-99.6147,-100.153,-100.666,-101.072,-101.486,-101.909,-102.339,-102.777,-103.222,-103.671,-104.126,-104.589,-105.06,-105.537,-106.022,-106.509,-107.003,-107.505,-108.013,-108.527,-109.045,-109.571,-110.103,-110.641,-111.186,-111.737,-112.295,-112.858,-113.428,-114.003,-114.584,-115.167,-115.756,-116.351,-116.95,-117.553,-118.162,-118.776,-119.396,-120.02,-120.65,-121.284,-121.923,-122.568,-123.217,-123.87,-124.528,-125.191,-125.858,-126.53,-127.206,-127.886,-128.57,-129.259,-129.951,-130.648,-131.348,-132.052,-132.759,-133.467,-134.178,-134.893,-135.612,-136.334,-137.06,-137.789,-138.521,-139.257,-139.996,-140.738,-141.484,-142.232,-142.984,-143.738,-144.496,-145.255,-146.016,-146.78,-147.547,-148.316,-149.088,-149.863,-150.64,-151.42,-152.201,-152.985,-153.771,-154.56,-155.351,-156.144,-156.862,-157.143,-157.425,-157.712,-158.002,-158.298,-158.6,-158.908,-159.221,-159.538,-159.86,-160.188,-160.521,-160.86,-161.204,-161.554,-161.906,-162.263,-162.626,-162.994,-163.368,-163.746,-164.13,-164.519,-164.865,-165.046,127.032,126.039,125.046,124.053,123.06,122.067,121.074,120.081,119.089,118.097,117.104,116.112,115.12,114.128,113.137,112.145,111.154,110.163,109.172,108.181,107.19,106.199,105.209,104.219,103.229,102.239,101.249,100.26,99.2707,98.2817,97.293,96.3045,95.3162,94.3282,93.3404,92.3529,91.3656,90.3787,89.392,88.4056,87.4192,86.4328,85.4466,84.4608,83.4753,82.4902,81.5054,80.521,79.5369,78.5533,77.5701,76.5874,75.6051,74.6232,73.6419,72.661,71.6807,70.701,69.7218,68.7432,67.7652,66.7879,65.8113,64.8354,63.8602,62.8858,61.9122,60.9395,59.9677,58.9968,58.0269,57.0581,56.0903,55.1237,54.1583,53.1942,52.2315,51.2701,50.3103,49.3521,48.3955,47.4408,46.4879,45.5371,44.5881,43.6395,42.6838,41.7287,40.7757,39.8217,38.8654,37.9113,36.9596,36.0105,35.0626,34.1176,33.1758,32.2375,31.3031,30.3728,29.4471,28.5264,27.5964,26.6564,25.7209,24.7904,23.862,22.9378,22.0165,21.0759,20.1388,19.1928,18.2514,17.3166,16.3894,15.4642,14.5307,13.598,12.6491,11.7007,10.7518,9.80434,8.86707,7.93848,6.99665,6.04992,5.09979,4.15049,3.20278,2.25347,1.28847,0.336573,-0.534,-1.48561,-2.43108,-3.3802,-4.33599,-5.30625,-6.26779,-7.23085,-8.20109,-9.17133,-10.1416,-11.1118,-12.0819,-13.0519,-14.0219,-14.9901,-15.9516,-16.9175,-17.8872,-18.8601,-19.8357,-20.8135,-21.7934,-22.7742,-23.7548,-24.7352,-25.7161,-26.6964,-27.677,-28.6577,-29.6398,-30.623,-31.6072,-32.5924,-33.5785,-34.5654,-35.553,-36.5413,-37.5302,-38.5197,-39.5097,-40.5001,-41.4896,-42.4795,-43.4699,-44.4594,-45.4493,-46.4396,-47.4293,-48.4191,-49.4094,-50.4,-51.391,-52.3824,-53.374,-54.366,-55.3583,-56.3508,-57.3432,-58.3351,-59.3274,-60.3199,-61.3126,-62.3056,-63.2988,-64.2922,-65.2858,-66.2796,-67.2736,-68.2678,-69.2621,-70.2566,-71.2512,-72.246,-73.241,-74.236,-75.2312,-76.2266,-77.2215,-78.1539,-78.3065,-78.4716,-78.649,-78.8333,-78.8822,-78.875,-78.875,-78.875,-78.8822,-78.902,-78.9344,-78.9796,-79.0373,-79.0997,-79.17,-79.2528,-79.3482,-79.456,-79.5763,-79.703,-79.8414,-79.9868,-80.1445,-80.3143,-80.4962,-80.6895,-80.8914,-81.1052,-81.3242,-81.5544,-81.7953,-82.0456,-82.3072,-82.5801,-82.8642,-83.1528,-83.4514,-83.7609,-84.0794,-84.4081,-84.7473,-85.0969,-85.4476,-85.8006,-86.1633,-86.5344,-86.9135,-87.3024,-87.7009,-88.092,-88.4849,-88.8873,-89.299,-89.7134,-90.136,-90.5677,-91.0082,-91.4552,-91.9024,-92.3499,-92.8036,-93.2657,-93.7363,-94.2104,-94.6888,-95.1754,-95.6699,-96.1677,-96.6733,-97.1865,-97.7073,-98.2355,-98.7711,-99.3124,-99.7514,-100.161,-100.579,-101.005,-101.439,-101.881,-102.328,-102.78,-103.239,-103.706,-104.18,-104.662,-105.148,-105.639,-106.137,-106.642,-107.155,-107.671,-108.194,-108.723,-109.259,-109.802,-110.351,-110.907,-111.468,-112.036,-112.609,-113.189,-113.771,-114.358,-114.952,-115.55,-116.152,-116.76,-117.373,-117.991,-118.614,-119.243,-119.876,-120.515,-121.158,-121.806,-122.459,-123.117,-123.779,-124.446,-125.117,-125.793,-126.473,-127.157,-127.845,-128.537,-129.234,-129.934,-130.638,-131.345,-132.053,-132.764,-133.479,-134.198,-134.92,-135.646,-136.375,-137.108,-137.844,-138.583,-139.326,-140.072,-140.821,-141.573,-142.328,-143.086,-143.845,-144.607,-145.371,-146.138,-146.908,-147.681,-148.456,-149.234,-150.015,-150.796,-151.581,-152.367,-153.157,-153.948,-154.742,-155.539,-155.904,-156.183,-156.467,-156.755,-157.046,-157.344,-157.648,-157.957,-158.272,-158.59,-158.914,-159.244,-159.579,-159.92,-160.266,-160.617,-160.971,-161.331,-161.696,-162.066,-162.441,-162.822,-163.208,-163.6,-163.881,-164.063,127.151,126.159,125.167,124.174,123.182,122.191,121.199,120.207,119.216,118.225,117.233,116.242,115.252,114.261,113.27,112.28,111.29,110.3,109.31,108.32,107.331,106.342,105.353,104.364,103.375,102.387,101.399,100.411,99.423,98.4355,97.4483,96.4614,95.4747,94.4884,93.502,92.5155,91.5294,90.5435,89.5579,88.5727,87.5878,86.6033,85.6191,84.6352,83.6518,82.6688,81.6861,80.7039,79.7222,78.7409,77.76,76.7797,75.7999,74.8206,73.8419,72.8637,71.8862,70.9093,69.933,68.9574,67.9825,67.0084,66.035,65.0625,64.0908,63.1199,62.15,61.1811,60.2132,59.2463,58.2806,57.316,56.3527,55.3907,54.43,53.4708,52.5131,51.557,50.6026,49.65,48.6993,47.7504,46.8018,45.8452,44.8905,43.9379,42.9827,42.027,41.0733,40.1219,39.1728,38.2248,37.2795,36.3371,35.3979,34.462,33.53,32.6019,31.6782,30.7564,29.8172,28.8801,27.9475,27.0189,26.0916,25.1698,24.2373,23.2985,22.3548,21.4123,20.4753,19.5445,18.6209,17.6887,16.7598,15.8114,14.8629,13.9141,12.9663,12.026,11.0962,10.1589,9.21149,8.26183,7.31277,6.36457,5.41158,4.44805,3.49833,2.56935,1.62259,0.673146,-0.225347,-1.18585,-2.15512,-3.10808,-4.07833,-5.04859,-6.01885,-6.98911,-7.95912,-8.92897,-9.8989,-10.8689,-11.8302,-12.7947,-13.7642,-14.7378,-15.7147,-16.6944,-17.6752,-18.6558,-19.6361,-20.6172,-21.5973,-22.578,-23.5588,-24.5411,-25.5248,-26.5097,-27.4957,-28.4827,-29.4706,-30.4592,-31.4486,-32.4386,-33.4291,-34.4185,-35.4084,-36.3989,-37.3884,-38.3783,-39.3687,-40.3583,-41.3481,-42.3384,-43.3291,-44.3203,-45.3119,-46.3038,-47.296,-48.2886,-49.281,-50.2729,-51.2651,-52.2577,-53.2505,-54.2436,-55.2369,-56.2304,-57.2242,-58.2182,-59.2124,-60.2068,-61.2014,-62.1962,-63.1911,-64.1862,-65.1814,-66.1768,-67.1717,-68.1664,-69.1613,-70.1564,-71.1515,-72.1468,-73.142,-74.1367,-75.1316,-76.1266,-77.023,-77.1648,-77.3194,-77.4865,-77.6662,-77.8504,-77.8822,-77.875,-77.875,-77.875,-77.8822,-77.9023,-77.9352,-77.9809,-78.0394,-78.1017,-78.1729,-78.2568,-78.3534,-78.4626,-78.584,-78.7119,-78.8512,-78.9985,-79.1582,-79.3301,-79.5143,-79.7092,-79.9136,-80.1288,-80.35,-80.583,-80.826,-81.0793,-81.344,-81.6201,-81.9063,-82.1973,-82.4993,-82.8121,-83.1338,-83.4662,-83.8092,-84.1608,-84.511,-84.8675,-85.2342,-85.6078,-85.991,-86.384,-86.7839,-87.1712,-87.5682,-87.9748,-88.3883,-88.806,-89.2328,-89.6688,-90.1136,-90.5608,-91.008,-91.4576,-91.9157,-92.3824,-92.8566,-93.3313,-93.8142,-94.3052,-94.8016,-95.304,-95.8141,-96.332,-96.8574,-97.3902,-97.9303,-98.4332,-98.8381,-99.2515,-99.6731,-100.103,-100.541,-100.986,-101.435,-101.89,-102.354,-102.825,-103.303,-103.788,-104.276,-104.771,-105.273,-105.783,-106.297,-106.818,-107.345,-107.878,-108.419,-108.966,-109.519,-110.078,-110.644,-111.216,-111.794,-112.375,-112.961,-113.553,-114.15,-114.751,-115.357,-115.969,-116.586,-117.208,-117.836,-118.469,-119.106,-119.749,-120.396,-121.049,-121.706,-122.368,-123.034,-123.705,-124.38,-125.059,-125.743,-126.431,-127.123,-127.819,-128.52,-129.224,-129.931,-130.639,-131.35,-132.065,-132.784,-133.506,-134.232,-134.962,-135.695,-136.431,-137.171,-137.914,-138.66,-139.409,-140.162,-140.917,-141.676,-142.435,-143.197,-143.962,-144.73,-145.5,-146.274,-147.05,-147.828,-148.609,-149.391,-150.176,-150.964,-151.754,-152.546,-153.341,-154.138,-154.66,-154.943,-155.223,-155.509,-155.797,-156.091,-156.391,-156.696,-157.007,-157.323,-157.644,-157.97,-158.301,-158.638,-158.981,-159.33,-159.681,-160.037,-160.399,-160.766,-161.138,-161.516,-161.899,-162.287,-162.681,-162.898,-163.08,127.278,126.287,125.295,124.304,123.313,122.323,121.332,120.341,119.351,118.361,117.371,116.381,115.391,114.402,113.413,112.424,111.435,110.446,109.457,108.469,107.481,106.493,105.506,104.518,103.531,102.544,101.557,100.571,99.5848,98.5983,97.6121,96.6262,95.6406,94.6553,93.6703,92.6856,91.7013,90.7173,89.7336,88.7504,87.7674,86.7849,85.8028,84.8211,83.8399,82.8591,81.8787,80.8989,79.9195,78.9406,77.9623,76.9846,76.0074,75.0308,74.0549,73.0796,72.105,71.131,70.1579,69.1854,68.2138,67.243,66.2731,65.3041,64.336,63.369,62.4029,61.438,60.4742,59.5116,58.5502,57.5901,56.6315,55.6743,54.7186,53.7645,52.8122,51.8616,50.9127,49.9628,49.0067,48.0524,47.1,46.144,45.1887,44.2353,43.2841,42.3351,41.387,40.4414,39.4985,38.5585,37.6216,36.688,35.758,34.8319,33.9099,32.9782,32.04,31.1057,30.1755,29.2471,28.3222,27.3988,26.4588,25.5169,24.5736,23.635,22.7016,21.7741,20.848,19.9158,18.9737,18.0252,17.0763,16.1284,15.1863,14.2522,13.3212,12.3734,11.424,10.475,9.52669,8.56797,7.60987,6.66058,5.72174,4.7836,3.83447,2.88111,1.91213,0.951972,0.,-0.929129,-1.89778,-2.86752,-3.83701,-4.80641,-5.7761,-6.74595,-7.71059,-8.67197,-9.64122,-10.6162,-11.5954,-12.5763,-13.5569,-14.5371,-15.5184,-16.4983,-17.479,-18.4598,-19.4426,-20.4271,-21.413,-22.4001,-23.3884,-24.3776,-25.3676,-26.3583,-27.3474,-28.3374,-29.328,-30.3173,-31.3072,-32.2977,-33.2872,-34.277,-35.2674,-36.2583,-37.2497,-38.2415,-39.2338,-40.2264,-41.2188,-42.2106,-43.2029,-44.1955,-45.1884,-46.1816,-47.1751,-48.1689,-49.1629,-50.1571,-51.1516,-52.1463,-53.1412,-54.1363,-55.1316,-56.127,-57.1219,-58.1166,-59.1115,-60.1065,-61.1017,-62.097,-63.0922,-64.0869,-65.0817,-66.0767,-67.0718,-68.0671,-69.0625,-70.0572,-71.052,-72.0469,-73.042,-74.0372,-75.0325,-75.9015,-76.0323,-76.176,-76.3326,-76.5019,-76.6839,-76.868,-76.8823,-76.875,-76.875,-76.875,-76.8823,-76.9027,-76.936,-76.9823,-77.0415,-77.1039,-77.176,-77.261,-77.3588,-77.4694,-77.5915,-77.7211,-77.8614,-78.0105,-78.1722,-78.3463,-78.5328,-78.7293,-78.9362,-79.1525,-79.3765,-79.6123,-79.8575,-80.1138,-80.3817,-80.6612,-80.9484,-81.2428,-81.5484,-81.8641,-82.1894,-82.5256,-82.8725,-83.2236,-83.5755,-83.9359,-84.3057,-84.683,-85.0703,-85.4676,-85.8608,-86.2522,-86.6534,-87.0643,-87.4786,-87.9005,-88.3318,-88.7722,-89.2191,-89.6663,-90.1138,-90.5677,-91.0302,-91.5014,-91.9754,-92.4546,-92.9421,-93.437,-93.936,-94.443,-94.9577,-95.4802,-96.0103,-96.5478,-97.0886,-97.5178,-97.9265,-98.3437,-98.7692,-99.203,-99.6449,-100.092,-100.544,-101.003,-101.471,-101.946,-102.428,-102.914,-103.406,-103.905,-104.412,-104.925,-105.443,-105.967,-106.498,-107.036,-107.581,-108.132,-108.689,-109.253,-109.823,-110.399,-110.98,-111.564,-112.154,-112.75,-113.35,-113.955,-114.566,-115.182,-115.803,-116.429,-117.061,-117.698,-118.34,-118.987,-119.638,-120.295,-120.956,-121.622,-122.292,-122.967,-123.646,-124.329,-125.017,-125.709,-126.405,-127.106,-127.81,-128.517,-129.225,-129.936,-130.651,-131.37,-132.093,-132.819,-133.549,-134.282,-135.018,-135.758,-136.502,-137.248,-137.998,-138.751,-139.507,-140.266,-141.026,-141.788,-142.553,-143.322,-144.093,-144.867,-145.643,-146.423,-147.204,-147.987,-148.772,-149.56,-150.351,-151.144,-151.94,-152.738,-153.418,-153.701,-153.983,-154.264,-154.551,-154.841,-155.137,-155.438,-155.745,-156.058,-156.375,-156.698,-157.026,-157.359,-157.698,-158.043,-158.393,-158.746,-159.104,-159.468,-159.837,-160.212,-160.592,-160.977,-161.367,-161.736,-161.914,-162.098,127.412,126.422,125.432,124.442,123.452,122.462,121.473,120.484,119.494,118.505,117.517,116.528,115.54,114.552,113.564,112.576,111.588,110.601,109.614,108.627,107.64,106.654,105.668,104.681,103.695,102.709,101.723,100.738,99.7528,98.768,97.7836,96.7994,95.8156,94.8321,93.8489,92.8662,91.8838,90.9017,89.9201,88.9389,87.9581,86.9777,85.9978,85.0184,84.0394,83.061,82.083,81.1056,80.1288,79.1525,78.1769,77.2018,76.2275,75.2537,74.2807,73.3084,72.3369,71.3661,70.3962,69.4271,68.4589,67.4917,66.5254,65.5601,64.5959,63.6327,62.6708,61.71,60.7505,59.7923,58.8356,57.8803,56.9265,55.9743,55.0239,54.075,53.124,52.1683,51.2144,50.262,49.3053,48.3504,47.3974,46.4464,45.4973,44.5492,43.6034,42.6601,41.7194,40.7815,39.8467,38.9151,37.9869,37.0626,36.1395,35.2003,34.2646,33.3326,32.404,31.4765,30.5536,29.6196,28.6791,27.7351,26.7953,25.86,24.9297,24.005,23.0736,22.1359,21.1874,20.2386,19.2905,18.3473,17.4105,16.481,15.5355,14.5862,13.6373,12.6889,11.7275,10.772,9.82284,8.8805,7.94562,6.99665,6.03376,5.0652,4.10839,3.13872,2.16957,1.20221,0.25,-0.690335,-1.65478,-2.62351,-3.59307,-4.55007,-5.51844,-6.49639,-7.47757,-8.45808,-9.43812,-10.4197,-11.3994,-12.38,-13.361,-14.3445,-15.3302,-16.3176,-17.3065,-18.2966,-19.2875,-20.2764,-21.2664,-22.2572,-23.2463,-24.2361,-25.2268,-26.2162,-27.206,-28.1964,-29.1876,-30.1793,-31.1715,-32.1643,-33.1566,-34.1484,-35.1406,-36.1333,-37.1263,-38.1197,-39.1135,-40.1075,-41.1019,-42.0965,-43.0913,-44.0864,-45.0817,-46.0773,-47.0722,-48.0668,-49.0616,-50.0566,-51.0518,-52.0472,-53.0425,-54.0371,-55.0318,-56.0268,-57.022,-58.0173,-59.0127,-60.0074,-61.0021,-61.997,-62.9921,-63.9874,-64.9828,-65.9783,-66.9739,-67.9697,-68.9656,-69.9617,-70.9578,-71.954,-72.9504,-73.9468,-74.7854,-74.9094,-75.0419,-75.1875,-75.3461,-75.5176,-75.702,-75.886,-75.8824,-75.875,-75.875,-75.875,-75.8824,-75.903,-75.9368,-75.9837,-76.0437,-76.1061,-76.1791,-76.2652,-76.3643,-76.4764,-76.5992,-76.7305,-76.8718,-77.0229,-77.1866,-77.3629,-77.5517,-77.7499,-77.9594,-78.1769,-78.4036,-78.6422,-78.8898,-79.1492,-79.4204,-79.7032,-79.9915,-80.2894,-80.5986,-80.9173,-81.2464,-81.5865,-81.9373,-82.2875,-82.6415,-83.006,-83.3784,-83.7598,-84.1514,-84.553,-84.9394,-85.335,-85.7406,-86.1539,-86.5708,-86.9971,-87.4328,-87.8775,-88.3247,-88.7719,-89.2216,-89.68,-90.1471,-90.6213,-91.0967,-91.5804,-92.0725,-92.5694,-93.0731,-93.5847,-94.1042,-94.6314,-95.1662,-95.7076,-96.2002,-96.6041,-97.0166,-97.4377,-97.8671,-98.3049,-98.7504,-99.1988,-99.6546,-100.118,-100.59,-101.069,-101.554,-102.043,-102.539,-103.042,-103.553,-104.069,-104.59,-105.119,-105.655,-106.197,-106.746,-107.301,-107.863,-108.431,-109.005,-109.585,-110.168,-110.756,-111.351,-111.95,-112.554,-113.163,-113.777,-114.398,-115.023,-115.654,-116.29,-116.931,-117.577,-118.228,-118.884,-119.544,-120.209,-120.879,-121.554,-122.233,-122.916,-123.603,-124.295,-124.991,-125.691,-126.395,-127.102,-127.81,-128.522,-129.237,-129.956,-130.679,-131.405,-132.135,-132.869,-133.606,-134.346,-135.09,-135.837,-136.587,-137.34,-138.097,-138.856,-139.616,-140.379,-141.145,-141.914,-142.685,-143.46,-144.237,-145.017,-145.798,-146.582,-147.368,-148.157,-148.949,-149.742,-150.539,-151.338,-152.138,-152.458,-152.743,-153.023,-153.306,-153.594,-153.885,-154.182,-154.486,-154.795,-155.11,-155.428,-155.752,-156.082,-156.418,-156.759,-157.106,-157.457,-157.812,-158.172,-158.538,-158.909,-159.286,-159.668,-160.056,-160.448,-160.752,-160.93,-161.115,127.555,126.565,125.576,124.588,123.599,122.61,121.622,120.634,119.646,118.658,117.671,116.684,115.696,114.71,113.723,112.737,111.75,110.764,109.778,108.792,107.806,106.821,105.835,104.85,103.866,102.882,101.898,100.914,99.9306,98.9476,97.9649,96.9826,96.0007,95.0191,94.0379,93.0571,92.0767,91.0968,90.1173,89.1382,88.1597,87.1816,86.204,85.2269,84.2504,83.2744,82.299,81.3242,80.35,79.3765,78.4036,77.4314,76.46,75.4892,74.5193,73.5502,72.5819,71.6144,70.6479,69.6823,68.7177,67.7542,66.7917,65.8303,64.8701,63.9111,62.9534,61.997,61.042,60.0885,59.1365,58.1861,57.2372,56.2853,55.33,54.3763,53.423,52.4668,51.5123,50.5595,49.6086,48.6596,47.7115,46.7655,45.8218,44.8805,43.9418,43.0059,42.0729,41.1431,40.2167,39.2939,38.361,37.4241,36.4906,35.5607,34.6323,33.7067,32.7806,31.8412,30.8968,29.956,29.0192,28.0867,27.159,26.2324,25.2982,24.3497,23.4009,22.4527,21.5087,20.57,19.6373,18.6976,17.7485,16.7996,15.848,14.8883,13.9341,12.9851,12.0411,11.1069,10.1566,9.18729,8.22534,7.26131,6.29143,5.32168,4.35217,3.38251,2.41253,1.44292,0.475986,-0.441942,-1.39754,-2.37993,-3.35992,-4.33914,-5.32168,-6.30042,-7.28118,-8.2623,-9.24747,-10.2355,-11.2257,-12.2171,-13.2054,-14.1953,-15.1866,-16.1753,-17.1651,-18.156,-19.1452,-20.1349,-21.1256,-22.1171,-23.1093,-24.1022,-25.0946,-26.0862,-27.0784,-28.0711,-29.0644,-30.0581,-31.0522,-32.0467,-33.0415,-34.0366,-35.032,-36.0276,-37.0225,-38.017,-39.0117,-40.0067,-41.002,-41.9975,-42.9928,-43.9873,-44.982,-45.9769,-46.9721,-47.9675,-48.963,-49.9576,-50.9523,-51.9472,-52.9423,-53.9375,-54.933,-55.9286,-56.9244,-57.9203,-58.9163,-59.9125,-60.9088,-61.9052,-62.9018,-63.8984,-64.8952,-65.892,-66.889,-67.886,-68.8831,-69.8803,-70.8776,-71.8749,-72.8724,-73.6692,-73.7932,-73.9174,-74.0518,-74.1993,-74.36,-74.5338,-74.7182,-74.9027,-74.8825,-74.875,-74.875,-74.875,-74.8825,-74.9034,-74.9376,-74.9851,-75.0459,-75.1083,-75.1823,-75.2696,-75.37,-75.4835,-75.6072,-75.7401,-75.8824,-76.0355,-76.2013,-76.3799,-76.5712,-76.7711,-76.9833,-77.2018,-77.4314,-77.6722,-77.9229,-78.1855,-78.46,-78.7457,-79.0357,-79.3372,-79.6499,-79.9717,-80.3047,-80.6488,-81.0002,-81.351,-81.709,-82.0774,-82.4527,-82.8384,-83.2343,-83.6298,-84.0198,-84.4198,-84.8297,-85.2438,-85.665,-86.0959,-86.5361,-86.983,-87.4303,-87.8778,-88.3318,-88.7947,-89.2665,-89.7405,-90.2204,-90.7089,-91.2043,-91.7045,-92.2129,-92.7293,-93.2535,-93.7855,-94.3251,-94.8654,-95.2843,-95.6921,-96.1085,-96.5336,-96.967,-97.4088,-97.8559,-98.3077,-98.7676,-99.2354,-99.711,-100.194,-100.681,-101.174,-101.674,-102.182,-102.696,-103.215,-103.741,-104.274,-104.814,-105.36,-105.913,-106.473,-107.039,-107.612,-108.19,-108.772,-109.359,-109.952,-110.55,-111.152,-111.76,-112.374,-112.993,-113.617,-114.247,-114.882,-115.522,-116.167,-116.817,-117.473,-118.133,-118.797,-119.467,-120.141,-120.819,-121.502,-122.19,-122.881,-123.577,-124.277,-124.981,-125.688,-126.396,-127.108,-127.823,-128.542,-129.265,-129.992,-130.722,-131.456,-132.193,-132.934,-133.678,-134.425,-135.176,-135.93,-136.687,-137.446,-138.206,-138.97,-139.736,-140.506,-141.278,-142.053,-142.831,-143.612,-144.393,-145.178,-145.965,-146.754,-147.546,-148.341,-149.138,-149.938,-150.738,-151.218,-151.499,-151.784,-152.063,-152.348,-152.636,-152.93,-153.229,-153.534,-153.845,-154.161,-154.482,-154.808,-155.14,-155.477,-155.821,-156.17,-156.521,-156.878,-157.241,-157.609,-157.982,-158.361,-158.746,-159.135,-159.53,-159.767,-159.947,-160.133,127.704,126.716,125.729,124.741,123.753,122.766,121.779,120.792,119.806,118.819,117.833,116.847,115.86,114.874,113.889,112.903,111.918,110.933,109.948,108.964,107.98,106.996,106.012,105.029,104.046,103.064,102.081,101.1,100.118,99.1369,98.1561,97.1757,96.1958,95.2162,94.2371,93.2584,92.2801,91.3024,90.3251,89.3483,88.3721,87.3964,86.4212,85.4466,84.4726,83.4993,82.5265,81.5544,80.583,79.6123,78.6424,77.6732,76.7048,75.7372,74.7705,73.8046,72.8397,71.8758,70.9128,69.9509,68.99,68.0303,67.0718,66.1145,65.1585,64.2038,63.2505,62.2987,61.3484,60.3995,59.4467,58.4918,57.5383,56.5841,55.6284,54.6742,53.7216,52.7709,51.8219,50.8737,49.9275,48.9835,48.0417,47.1024,46.1655,45.2314,44.3002,43.372,42.4471,41.5218,40.584,39.6492,38.7177,37.7891,36.8615,35.9377,35.0028,34.0586,33.117,32.179,31.2448,30.3148,29.3894,28.4586,27.5119,26.5632,25.6149,24.6703,23.7303,22.7953,21.8598,20.9107,19.9619,19.0075,18.0495,17.0963,16.1474,15.2024,14.2649,13.31,12.3453,11.3843,10.4143,9.44433,8.47446,7.50443,6.53417,5.5639,4.59364,3.62338,2.66121,1.68286,0.698771,-0.25,-1.20221,-2.18303,-3.16475,-4.15519,-5.14857,-6.13456,-7.12445,-8.11682,-9.10443,-10.0941,-11.0856,-12.0743,-13.0638,-14.0549,-15.0471,-16.0402,-17.0327,-18.024,-19.0161,-20.0091,-21.0027,-21.9969,-22.9916,-23.9867,-24.9823,-25.9781,-26.9729,-27.9672,-28.9619,-29.9569,-30.9522,-31.9478,-32.9432,-33.9375,-34.9321,-35.9271,-36.9223,-37.9177,-38.9134,-39.9078,-40.9024,-41.8973,-42.8924,-43.8877,-44.8833,-45.879,-46.8749,-47.871,-48.8672,-49.8636,-50.8602,-51.8568,-52.8536,-53.8506,-54.8476,-55.8447,-56.842,-57.8393,-58.8367,-59.8342,-60.8318,-61.8295,-62.8272,-63.825,-64.8229,-65.8208,-66.8188,-67.8169,-68.815,-69.8132,-70.8114,-71.8097,-72.5605,-72.6766,-72.8007,-72.9257,-73.0619,-73.2114,-73.3743,-73.5504,-73.7348,-73.9038,-73.8826,-73.875,-73.875,-73.875,-73.8826,-73.9038,-73.9385,-73.9866,-74.0483,-74.1106,-74.1856,-74.274,-74.3758,-74.4908,-74.6153,-74.75,-74.8934,-75.0484,-75.2165,-75.3974,-75.5905,-75.7928,-76.0074,-76.2275,-76.46,-76.703,-76.9568,-77.2227,-77.5006,-77.7875,-78.081,-78.3862,-78.7018,-79.0275,-79.3645,-79.7126,-80.0635,-80.416,-80.7782,-81.1493,-81.5288,-81.9189,-82.3192,-82.7077,-83.102,-83.5064,-83.9196,-84.3356,-84.7614,-85.1968,-85.6414,-86.0886,-86.5358,-86.9856,-87.4443,-87.9119,-88.3861,-88.8621,-89.3468,-89.84,-90.3374,-90.8424,-91.3556,-91.8768,-92.4059,-92.9427,-93.4837,-93.9673,-94.3702,-94.7819,-95.2023,-95.6313,-96.0689,-96.5143,-96.9628,-97.4187,-97.8828,-98.3548,-98.8346,-99.3201,-99.8097,-100.307,-100.812,-101.324,-101.84,-102.363,-102.894,-103.431,-103.975,-104.526,-105.084,-105.648,-106.219,-106.795,-107.377,-107.962,-108.553,-109.15,-109.751,-110.358,-110.97,-111.588,-112.211,-112.84,-113.474,-114.113,-114.758,-115.407,-116.062,-116.721,-117.385,-118.054,-118.728,-119.406,-120.089,-120.776,-121.467,-122.163,-122.863,-123.567,-124.274,-124.982,-125.693,-126.409,-127.128,-127.851,-128.578,-129.309,-130.043,-130.78,-131.521,-132.266,-133.014,-133.765,-134.519,-135.276,-136.036,-136.797,-137.561,-138.328,-139.098,-139.871,-140.647,-141.425,-142.206,-142.988,-143.773,-144.561,-145.351,-146.144,-146.94,-147.738,-148.538,-149.339,-149.981,-150.258,-150.54,-150.823,-151.104,-151.391,-151.68,-151.975,-152.276,-152.583,-152.896,-153.213,-153.536,-153.864,-154.198,-154.537,-154.883,-155.233,-155.587,-155.946,-156.31,-156.681,-157.056,-157.438,-157.824,-158.216,-158.608,-158.783,-158.964,-159.151,127.862,126.875,125.889,124.902,123.916,122.929,121.943,120.957,119.971,118.986,118.001,117.015,116.031,115.046,114.062,113.078,112.094,111.111,110.128,109.145,108.162,107.18,106.199,105.217,104.236,103.255,102.275,101.295,100.315,99.3359,98.3571,97.3788,96.4009,95.4234,94.4464,93.4699,92.4939,91.5184,90.5435,89.5691,88.5953,87.6221,86.6494,85.6774,84.7061,83.7354,82.7655,81.7962,80.8277,79.86,78.8931,77.927,76.9618,75.9975,75.0342,74.0718,73.1104,72.15,71.1908,70.2326,69.2757,68.32,67.3656,66.4125,65.4609,64.5107,63.5618,62.6082,61.6535,60.7004,59.7454,58.79,57.8361,56.8838,55.9331,54.9842,54.0359,53.0896,52.1453,51.2031,50.2631,49.3255,48.3904,47.458,46.5283,45.6016,44.6781,43.7443,42.8084,41.8756,40.9458,40.0174,39.0915,38.1634,37.2205,36.2783,35.3393,34.4037,33.4718,32.544,31.6171,30.6742,29.7254,28.7772,27.8321,26.891,25.9543,25.022,24.073,23.1242,22.1678,21.2111,20.2586,19.3097,18.364,17.4245,16.4668,15.505,14.5373,13.5673,12.5973,11.6272,10.6569,9.68669,8.71645,7.74622,6.77916,5.7977,4.81899,3.83701,2.8566,1.87604,0.877229,-0.0625,-1.0625,-2.03485,-3.02335,-4.01754,-5.0039,-5.99283,-6.98492,-7.97898,-8.97153,-9.96184,-10.9539,-11.9473,-12.9417,-13.9369,-14.9328,-15.9292,-16.9238,-17.9176,-18.912,-19.907,-20.9025,-21.8984,-22.8939,-23.8878,-24.8823,-25.8772,-26.8725,-27.8681,-28.864,-29.8581,-30.8526,-31.8474,-32.8425,-33.838,-34.8336,-35.8296,-36.8257,-37.8221,-38.8186,-39.8153,-40.8122,-41.8092,-42.8063,-43.8036,-44.801,-45.7986,-46.7962,-47.7939,-48.7917,-49.7896,-50.7876,-51.7857,-52.7838,-53.782,-54.7803,-55.7787,-56.777,-57.7755,-58.774,-59.7726,-60.7712,-61.7698,-62.7685,-63.7672,-64.766,-65.7648,-66.7636,-67.7624,-68.7604,-69.7584,-70.7565,-71.4625,-71.5665,-71.6843,-71.8084,-71.9343,-72.0723,-72.2239,-72.389,-72.5675,-72.7517,-72.9042,-72.8827,-72.875,-72.875,-72.875,-72.8827,-72.9042,-72.9393,-72.9881,-73.0505,-73.113,-73.189,-73.2786,-73.3818,-73.4984,-73.6236,-73.7602,-73.9046,-74.0618,-74.232,-74.4154,-74.6102,-74.8151,-75.0308,-75.2537,-75.4892,-75.7346,-75.9916,-76.2609,-76.5423,-76.8303,-77.1274,-77.4364,-77.7551,-78.0847,-78.4258,-78.7776,-79.1272,-79.4826,-79.849,-80.2228,-80.6068,-81.0013,-81.3991,-81.7875,-82.1862,-82.5951,-83.009,-83.4296,-83.86,-84.3001,-84.747,-85.1942,-85.6417,-86.0959,-86.5592,-87.0316,-87.5056,-87.9864,-88.4759,-88.9718,-89.4733,-89.9832,-90.5012,-91.0273,-91.5613,-92.1029,-92.6429,-93.0509,-93.4578,-93.8735,-94.2979,-94.7311,-95.1727,-95.6199,-96.0718,-96.5319,-97.0002,-97.4765,-97.9606,-98.4472,-98.9411,-99.4427,-99.9517,-100.466,-100.987,-101.515,-102.05,-102.591,-103.14,-103.695,-104.258,-104.826,-105.401,-105.982,-106.565,-107.155,-107.75,-108.35,-108.956,-109.566,-110.183,-110.805,-111.433,-112.066,-112.705,-113.348,-113.997,-114.651,-115.31,-115.973,-116.642,-117.315,-117.993,-118.675,-119.362,-120.053,-120.749,-121.449,-122.153,-122.86,-123.568,-124.279,-124.995,-125.714,-126.438,-127.165,-127.895,-128.63,-129.368,-130.109,-130.854,-131.602,-132.354,-133.108,-133.866,-134.626,-135.387,-136.152,-136.92,-137.69,-138.464,-139.24,-140.02,-140.801,-141.584,-142.369,-143.158,-143.949,-144.743,-145.539,-146.338,-147.138,-147.94,-148.745,-149.019,-149.298,-149.583,-149.863,-150.145,-150.433,-150.724,-151.021,-151.324,-151.633,-151.947,-152.266,-152.59,-152.92,-153.256,-153.598,-153.946,-154.297,-154.653,-155.014,-155.381,-155.753,-156.131,-156.515,-156.903,-157.298,-157.623,-157.799,-157.981,-158.17,128.026,127.04,126.054,125.068,124.083,123.098,122.113,121.129,120.144,119.16,118.176,117.193,116.209,115.226,114.244,113.261,112.279,111.297,110.316,109.335,108.354,107.374,106.394,105.414,104.435,103.456,102.477,101.499,100.522,99.5446,98.5679,97.5916,96.6159,95.6406,94.6659,93.6916,92.718,91.7449,90.7724,89.8005,88.8292,87.8586,86.8886,85.9193,84.9507,83.9829,83.0158,82.0495,81.0841,80.1194,79.1557,78.1929,77.231,76.2701,75.3102,74.3514,73.3936,72.437,71.4816,70.5275,69.5746,68.6231,67.6729,66.7241,65.7698,64.8154,63.8624,62.9068,61.9517,60.9981,60.0459,59.0954,58.1464,57.1982,56.2517,55.3072,54.3646,53.4241,52.4858,51.5498,50.6163,49.6853,48.7571,47.8318,46.9048,45.9681,45.034,44.1029,43.1743,42.2465,41.3221,40.3824,39.4397,38.4998,37.5631,36.6297,35.7,34.7741,33.8365,32.8877,31.9394,30.994,30.052,29.114,28.1802,27.2352,26.2864,25.3285,24.3728,23.4208,22.4719,21.5259,20.5849,19.6254,18.6603,17.6903,16.7202,15.7501,14.7799,13.8097,12.8395,11.8692,10.8967,9.91704,8.93575,7.94635,6.95662,5.9703,4.9769,3.98679,3.00325,2.00877,1.01743,0.0625,-0.929129,-1.90086,-2.89193,-3.88758,-4.88501,-5.88331,-6.8767,-7.86855,-8.86223,-9.85718,-10.8531,-11.8496,-12.8454,-13.8385,-14.8325,-15.8273,-16.8227,-17.8186,-18.815,-19.8087,-20.8028,-21.7975,-22.7927,-23.7883,-24.7842,-25.7805,-26.777,-27.7738,-28.7708,-29.768,-30.7654,-31.7629,-32.7606,-33.7584,-34.7564,-35.7545,-36.7527,-37.7509,-38.7493,-39.7477,-40.7463,-41.7449,-42.7435,-43.7422,-44.741,-45.7398,-46.7387,-47.7376,-48.7366,-49.7354,-50.7333,-51.7312,-52.7292,-53.7272,-54.7253,-55.7235,-56.7218,-57.7201,-58.7185,-59.7169,-60.7154,-61.714,-62.7125,-63.7112,-64.7098,-65.7085,-66.7073,-67.7061,-68.7049,-69.7038,-70.375,-70.4673,-70.5728,-70.6923,-70.8163,-70.943,-71.083,-71.2367,-71.4041,-71.585,-71.7692,-71.9046,-71.8829,-71.875,-71.875,-71.875,-71.8829,-71.9046,-71.9402,-71.9897,-72.0521,-72.1154,-72.1925,-72.2834,-72.3879,-72.5061,-72.6322,-72.7703,-72.9162,-73.0754,-73.248,-73.4338,-73.6303,-73.838,-74.0549,-74.2807,-74.5191,-74.767,-75.0273,-75.3001,-75.585,-75.8742,-76.1751,-76.4876,-76.8097,-77.1434,-77.4886,-77.8398,-78.1912,-78.5509,-78.9205,-79.2982,-79.6866,-80.0856,-80.4764,-80.8692,-81.2724,-81.6854,-82.1005,-82.5258,-82.9608,-83.4054,-83.8525,-84.2998,-84.7496,-85.2086,-85.6767,-86.1509,-86.6277,-87.1133,-87.6076,-88.1056,-88.6121,-89.1269,-89.6499,-90.1809,-90.7199,-91.2604,-91.7345,-92.1363,-92.5472,-92.9669,-93.3955,-93.8328,-94.2782,-94.7268,-95.1829,-95.6473,-96.1199,-96.6005,-97.0862,-97.5768,-98.0751,-98.581,-99.094,-99.6118,-100.137,-100.669,-101.208,-101.755,-102.308,-102.868,-103.434,-104.007,-104.587,-105.169,-105.757,-106.351,-106.95,-107.554,-108.163,-108.779,-109.4,-110.026,-110.659,-111.296,-111.939,-112.587,-113.24,-113.898,-114.561,-115.229,-115.902,-116.58,-117.262,-117.948,-118.639,-119.335,-120.035,-120.739,-121.446,-122.153,-122.865,-123.581,-124.3,-125.024,-125.751,-126.482,-127.217,-127.955,-128.697,-129.442,-130.191,-130.943,-131.698,-132.457,-133.216,-133.978,-134.743,-135.511,-136.283,-137.057,-137.834,-138.614,-139.395,-140.179,-140.966,-141.755,-142.547,-143.341,-144.138,-144.938,-145.738,-146.541,-147.347,-147.784,-148.058,-148.339,-148.624,-148.903,-149.187,-149.475,-149.768,-150.067,-150.372,-150.683,-150.999,-151.319,-151.646,-151.978,-152.316,-152.66,-153.01,-153.362,-153.72,-154.083,-154.452,-154.827,-155.207,-155.593,-155.984,-156.38,-156.639,-156.816,-156.999,-157.188,128.196,127.211,126.226,125.242,124.258,123.275,122.291,121.308,120.325,119.342,118.36,117.378,116.396,115.415,114.434,113.453,112.473,111.493,110.513,109.534,108.555,107.576,106.598,105.62,104.643,103.666,102.689,101.713,100.738,99.7628,98.7883,97.8142,96.8407,95.8677,94.8953,93.9235,92.9523,91.9817,91.0117,90.0424,89.0737,88.1058,87.1385,86.1721,85.2064,84.2415,83.2774,82.3142,81.3519,80.3905,79.43,78.4705,77.5121,76.5547,75.5984,74.6433,73.6894,72.7367,71.7853,70.8352,69.8863,68.9314,67.9773,67.0244,66.0683,65.1135,64.1601,63.2081,62.2577,61.3087,60.3604,59.4139,58.4691,57.5261,56.5852,55.6463,54.7095,53.7751,52.843,51.9135,50.9866,50.0625,49.128,48.193,47.2606,46.331,45.4026,44.4763,43.5444,42.6012,41.6607,40.723,39.7884,38.857,37.9291,36.9987,36.05,35.1016,34.1559,33.2133,32.2742,31.3389,30.3975,29.4476,28.4896,27.5347,26.5831,25.6342,24.6878,23.7458,22.7834,21.8133,20.8433,19.8731,18.9029,17.9327,16.9625,15.9923,15.0157,14.0275,13.0392,12.0476,11.0576,10.0695,9.078,8.08765,7.09588,6.10136,5.10897,4.12026,3.12562,2.12592,1.12673,0.139754,-0.8125,-1.8125,-2.80694,-3.79195,-4.78319,-5.77745,-6.7734,-7.77039,-8.76806,-9.76001,-10.7533,-11.7477,-12.743,-13.7389,-14.7354,-15.7324,-16.7297,-17.7273,-18.7252,-19.7233,-20.7216,-21.72,-22.7186,-23.7172,-24.716,-25.7149,-26.7139,-27.713,-28.7121,-29.7112,-30.7105,-31.7094,-32.7069,-33.7044,-34.7021,-35.7,-36.6979,-37.696,-38.6942,-39.6924,-40.6908,-41.6892,-42.6877,-43.6862,-44.6849,-45.6836,-46.6823,-47.6811,-48.68,-49.6789,-50.6778,-51.6768,-52.6758,-53.6748,-54.6739,-55.673,-56.6722,-57.6714,-58.6706,-59.6698,-60.6691,-61.6684,-62.6677,-63.667,-64.6664,-65.6657,-66.6651,-67.6645,-68.664,-69.2912,-69.3795,-69.4723,-69.5792,-69.7001,-69.8242,-69.952,-70.094,-70.2498,-70.4196,-70.603,-70.7871,-70.905,-70.883,-70.875,-70.875,-70.875,-70.883,-70.905,-70.9411,-70.9913,-71.0537,-71.1179,-71.1961,-71.2882,-71.3942,-71.514,-71.6411,-71.7802,-71.9281,-72.0895,-72.2644,-72.4527,-72.6511,-72.8615,-73.0796,-73.3084,-73.5491,-73.8002,-74.064,-74.3402,-74.6267,-74.9192,-75.2239,-75.5396,-75.8657,-76.2035,-76.5529,-76.9036,-77.2568,-77.6208,-77.9933,-78.3754,-78.7684,-79.1688,-79.5555,-79.9528,-80.3606,-80.7744,-81.1942,-81.6241,-82.064,-82.5109,-82.9581,-83.4056,-83.86,-84.3238,-84.7968,-85.2708,-85.7524,-86.243,-86.7394,-87.2423,-87.7538,-88.2736,-88.8016,-89.3377,-89.8788,-90.421,-90.8177,-91.2235,-91.6384,-92.0624,-92.4951,-92.9367,-93.3838,-93.8358,-94.2963,-94.765,-95.242,-95.7267,-96.2138,-96.7088,-97.2116,-97.722,-98.2376,-98.7598,-99.2894,-99.8261,-100.37,-100.921,-101.478,-102.043,-102.614,-103.192,-103.773,-104.359,-104.952,-105.55,-106.152,-106.761,-107.375,-107.995,-108.62,-109.251,-109.888,-110.53,-111.177,-111.829,-112.487,-113.15,-113.817,-114.489,-115.166,-115.848,-116.535,-117.225,-117.921,-118.62,-119.324,-120.031,-120.739,-121.451,-122.167,-122.887,-123.61,-124.338,-125.069,-125.804,-126.542,-127.285,-128.03,-128.779,-129.532,-130.288,-131.047,-131.806,-132.569,-133.335,-134.103,-134.875,-135.65,-136.428,-137.208,-137.99,-138.775,-139.562,-140.352,-141.145,-141.94,-142.738,-143.538,-144.339,-145.143,-145.95,-146.552,-146.822,-147.098,-147.38,-147.663,-147.943,-148.23,-148.518,-148.813,-149.114,-149.421,-149.734,-150.051,-150.373,-150.702,-151.036,-151.376,-151.722,-152.073,-152.427,-152.787,-153.153,-153.524,-153.901,-154.284,-154.672,-155.065,-155.464,-155.654,-155.832,-156.016,-156.207,128.373,127.39,126.407,125.424,124.441,123.459,122.477,121.495,120.514,119.533,118.552,117.572,116.592,115.612,114.633,113.654,112.675,111.697,110.719,109.741,108.764,107.787,106.811,105.835,104.86,103.885,102.911,101.937,100.963,99.9906,99.0183,98.0465,97.0754,96.1048,95.1348,94.1654,93.1967,92.2287,91.2613,90.2947,89.3287,88.3636,87.3992,86.4357,85.4729,84.5111,83.5501,82.5901,81.631,80.673,79.7159,78.7599,77.805,76.8513,75.8988,74.9475,73.9975,73.0482,72.0931,71.1392,70.1856,69.2298,68.2753,67.3221,66.3703,65.4199,64.471,63.5227,62.576,61.631,60.6878,59.7464,58.807,57.8695,56.9342,56.0012,55.0705,54.1422,53.2166,52.2883,51.3523,50.4189,49.488,48.5594,47.6316,46.7064,45.7628,44.8217,43.8832,42.9475,42.0147,41.0851,40.1589,39.2123,38.2639,37.3179,36.3748,35.4348,34.4982,33.5598,32.6081,31.651,30.6967,29.7453,28.7965,27.8498,26.9055,25.9364,24.9663,23.9962,23.026,22.0558,21.0856,20.1096,19.1186,18.1286,17.1397,16.1488,15.1567,14.1634,13.1679,12.1715,11.1756,10.1806,9.18665,8.19418,7.2008,6.20295,5.20592,4.21029,3.21738,2.23082,1.25,0.25,-0.71261,-1.69788,-2.69403,-3.69226,-4.69125,-5.69059,-6.69013,-7.68979,-8.68952,-9.68931,-10.6891,-11.689,-12.6889,-13.6881,-14.6838,-15.68,-16.6767,-17.6738,-18.6712,-19.6688,-20.6667,-21.6648,-22.663,-23.6614,-24.66,-25.6586,-26.6573,-27.6562,-28.6551,-29.6541,-30.6531,-31.6522,-32.6514,-33.6506,-34.6499,-35.6492,-36.6485,-37.6479,-38.6473,-39.6467,-40.6462,-41.6457,-42.6452,-43.6447,-44.6443,-45.6439,-46.6435,-47.6431,-48.6427,-49.6424,-50.642,-51.6417,-52.6414,-53.6411,-54.6408,-55.6405,-56.6402,-57.6399,-58.6393,-59.638,-60.6368,-61.6356,-62.6344,-63.6333,-64.6322,-65.6311,-66.6301,-67.6291,-68.2195,-68.2945,-68.3833,-68.4773,-68.5859,-68.7075,-68.8316,-68.9613,-69.1053,-69.2634,-69.4355,-69.62,-69.8045,-69.9054,-69.8831,-69.875,-69.875,-69.875,-69.8831,-69.9054,-69.9421,-69.993,-70.0554,-70.1205,-70.1998,-70.2932,-70.4007,-70.5217,-70.6501,-70.7903,-70.9403,-71.1039,-71.2813,-71.4722,-71.6724,-71.8857,-72.105,-72.3369,-72.5799,-72.8344,-73.1016,-73.3815,-73.6691,-73.9655,-74.2741,-74.5929,-74.9231,-75.2652,-75.6169,-75.967,-76.3241,-76.6923,-77.0678,-77.4545,-77.8521,-78.2453,-78.6365,-79.0384,-79.4509,-79.8655,-80.2901,-80.7248,-81.1693,-81.6165,-82.0637,-82.5136,-82.9729,-83.4416,-83.9157,-84.3933,-84.8799,-85.3747,-85.874,-86.382,-86.8985,-87.4234,-87.9565,-88.4977,-89.0377,-89.502,-89.9026,-90.3125,-90.7316,-91.1598,-91.5968,-92.0422,-92.4907,-92.9471,-93.4119,-93.8851,-94.3665,-94.8524,-95.344,-95.8435,-96.3508,-96.8646,-97.3839,-97.9107,-98.4448,-98.9861,-99.5346,-100.09,-100.652,-101.221,-101.797,-102.378,-102.962,-103.553,-104.15,-104.751,-105.358,-105.971,-106.589,-107.214,-107.844,-108.48,-109.121,-109.767,-110.419,-111.076,-111.738,-112.405,-113.077,-113.753,-114.435,-115.121,-115.812,-116.507,-117.206,-117.91,-118.617,-119.325,-120.037,-120.753,-121.473,-122.196,-122.924,-123.656,-124.391,-125.13,-125.872,-126.618,-127.368,-128.121,-128.877,-129.636,-130.396,-131.16,-131.926,-132.696,-133.468,-134.244,-135.022,-135.803,-136.585,-137.371,-138.159,-138.949,-139.743,-140.539,-141.338,-142.138,-142.94,-143.745,-144.552,-145.323,-145.588,-145.86,-146.138,-146.422,-146.703,-146.985,-147.272,-147.562,-147.859,-148.162,-148.47,-148.785,-149.104,-149.428,-149.759,-150.095,-150.437,-150.786,-151.137,-151.494,-151.856,-152.224,-152.597,-152.977,-153.361,-153.752,-154.148,-154.496,-154.669,-154.849,-155.034,-155.226,128.558,127.576,126.594,125.613,124.632,123.651,122.671,121.691,120.711,119.731,118.752,117.774,116.795,115.817,114.84,113.862,112.885,111.909,110.933,109.957,108.982,108.008,107.033,106.06,105.086,104.114,103.141,102.17,101.198,100.228,99.2579,98.2885,97.3197,96.3516,95.3841,94.4173,93.4512,92.4858,91.5212,90.5573,89.5942,88.632,87.6705,86.71,85.7504,84.7917,83.8339,82.8772,81.9215,80.9668,80.0133,79.0609,78.1097,77.1597,76.2096,75.2548,74.3011,73.3469,72.3914,71.4371,70.4842,69.5325,68.5822,67.6333,66.685,65.7382,64.793,63.8495,62.9077,61.9678,61.0298,60.0937,59.1598,58.2281,57.2986,56.3716,55.4471,54.512,53.5776,52.6456,51.7162,50.7877,49.8613,48.9246,47.9829,47.0437,46.1071,45.1731,44.2421,43.3141,42.3745,41.4261,40.4799,39.5364,38.5957,37.658,36.722,35.7688,34.8125,33.8587,32.9076,31.9588,31.0119,30.0594,29.0894,28.1192,27.149,26.1788,25.1996,24.2104,23.2168,22.2209,21.2254,20.2304,19.2359,18.242,17.2475,16.2512,15.2554,14.2601,13.2656,12.272,11.2793,10.2822,9.28562,8.28991,7.29539,6.30259,5.3125,4.3125,3.3125,2.3125,1.3125,0.3125,-0.6875,-1.65478,-2.64354,-3.63844,-4.63555,-5.63367,-6.63237,-7.6314,-8.63066,-9.63007,-10.6296,-11.6292,-12.6289,-13.6286,-14.6283,-15.6281,-16.6279,-17.6278,-18.6276,-19.6275,-20.6274,-21.6273,-22.6272,-23.6271,-24.627,-25.6269,-26.6268,-27.6268,-28.6267,-29.6266,-30.6266,-31.6258,-32.6239,-33.622,-34.6203,-35.6187,-36.6172,-37.6157,-38.6143,-39.613,-40.6118,-41.6106,-42.6095,-43.6084,-44.6074,-45.6064,-46.6054,-47.6045,-48.6037,-49.6028,-50.602,-51.6013,-52.6005,-53.5998,-54.5991,-55.5985,-56.5978,-57.5972,-58.5966,-59.5961,-60.5955,-61.595,-62.5945,-63.594,-64.5935,-65.593,-66.5925,-67.1604,-67.2218,-67.298,-67.3871,-67.4825,-67.5927,-67.7152,-67.8393,-67.9709,-68.1169,-68.2773,-68.4519,-68.6363,-68.8207,-68.9059,-68.8832,-68.875,-68.875,-68.875,-68.8832,-68.9059,-68.9431,-68.9947,-69.0571,-69.1231,-69.2036,-69.2983,-69.4074,-69.5292,-69.6595,-69.8007,-69.9528,-70.1188,-70.2986,-70.4915,-70.6942,-70.9093,-71.131,-71.3661,-71.6116,-71.8695,-72.1403,-72.4239,-72.7127,-73.0129,-73.3253,-73.6477,-73.9821,-74.3285,-74.6796,-75.0316,-75.3931,-75.7641,-76.1443,-76.5356,-76.938,-77.3236,-77.7195,-78.1261,-78.5398,-78.9589,-79.3883,-79.8279,-80.2748,-80.7221,-81.1696,-81.6241,-82.0884,-82.5621,-83.036,-83.5186,-84.0103,-84.5072,-85.0116,-85.5247,-86.0463,-86.5764,-87.1147,-87.6553,-88.1893,-88.5846,-88.9893,-89.4034,-89.8268,-90.2592,-90.7006,-91.1477,-91.5999,-92.0606,-92.5299,-93.0076,-93.4925,-93.9806,-94.4767,-94.9808,-95.4927,-96.0091,-96.533,-97.0644,-97.6032,-98.1491,-98.7022,-99.2623,-99.8292,-100.403,-100.983,-101.566,-102.155,-102.75,-103.35,-103.956,-104.567,-105.185,-105.808,-106.437,-107.072,-107.712,-108.357,-109.008,-109.665,-110.326,-110.992,-111.664,-112.34,-113.021,-113.707,-114.398,-115.093,-115.792,-116.496,-117.203,-117.911,-118.623,-119.339,-120.059,-120.783,-121.511,-122.242,-122.978,-123.717,-124.46,-125.207,-125.957,-126.71,-127.467,-128.226,-128.987,-129.751,-130.518,-131.288,-132.061,-132.837,-133.616,-134.397,-135.181,-135.967,-136.755,-137.547,-138.341,-139.138,-139.938,-140.738,-141.542,-142.347,-143.156,-143.966,-144.358,-144.625,-144.898,-145.178,-145.464,-145.743,-146.027,-146.314,-146.607,-146.905,-147.21,-147.521,-147.837,-148.157,-148.484,-148.816,-149.155,-149.499,-149.849,-150.202,-150.561,-150.925,-151.296,-151.671,-152.053,-152.44,-152.833,-153.231,-153.511,-153.685,-153.866,-154.052,-154.245,128.75,127.77,126.79,125.81,124.83,123.851,122.872,121.894,120.916,119.938,118.961,117.984,117.007,116.031,115.055,114.079,113.104,112.13,111.156,110.182,109.209,108.236,107.264,106.293,105.322,104.351,103.381,102.412,101.443,100.474,99.5069,98.54,97.5737,96.6081,95.6432,94.6791,93.7157,92.753,91.7912,90.8302,89.87,88.9108,87.9524,86.995,86.0385,85.083,84.1286,83.1753,82.223,81.2719,80.322,79.3712,78.4166,77.4631,76.5083,75.5531,74.599,73.6462,72.6947,71.7444,70.7955,69.8472,68.9003,67.955,67.0113,66.0692,65.1288,64.1902,63.2535,62.3188,61.3861,60.4556,59.5274,58.6015,57.672,56.7368,55.8038,54.8731,53.9446,53.0167,52.0864,51.1443,50.2045,49.267,48.3321,47.3998,46.4703,45.5368,44.5884,43.642,42.6981,41.7567,40.8182,39.8826,38.9299,37.9741,37.0207,36.0699,35.1211,34.174,33.2124,32.2423,31.2721,30.2803,29.2856,28.2912,27.2965,26.3007,25.3052,24.31,23.3153,22.321,21.3236,20.3241,19.3247,18.3254,17.3261,16.327,15.3279,14.329,13.3302,12.3317,11.3334,10.3354,9.33784,8.34088,7.34475,6.34983,5.3568,4.36696,3.375,2.375,1.375,0.375,-0.625,-1.625,-2.625,-3.625,-4.625,-5.625,-6.625,-7.625,-8.6207,-9.61465,-10.6097,-11.6057,-12.6022,-13.5993,-14.5968,-15.5946,-16.5927,-17.5909,-18.5894,-19.588,-20.5868,-21.5857,-22.5846,-23.5837,-24.5828,-25.5821,-26.5813,-27.5806,-28.58,-29.5794,-30.5789,-31.5783,-32.5779,-33.5774,-34.577,-35.5766,-36.5762,-37.5758,-38.5755,-39.5751,-40.5748,-41.5745,-42.5742,-43.574,-44.5737,-45.5735,-46.5732,-47.573,-48.5728,-49.5726,-50.5724,-51.5722,-52.572,-53.5718,-54.5717,-55.5715,-56.5713,-57.5712,-58.571,-59.5709,-60.5708,-61.5706,-62.5705,-63.5704,-64.5702,-65.5701,-66.1064,-66.1619,-66.2242,-66.3015,-66.391,-66.4879,-66.5997,-66.7231,-66.8471,-66.9807,-67.1289,-67.2916,-67.4688,-67.6531,-67.8374,-67.9063,-67.8833,-67.875,-67.875,-67.875,-67.8833,-67.9063,-67.9441,-67.9965,-68.0589,-68.1259,-68.2075,-68.3036,-68.4142,-68.537,-68.6691,-68.8115,-68.9657,-69.1341,-69.3164,-69.5112,-69.7168,-69.933,-70.1579,-70.396,-70.6442,-70.9056,-71.18,-71.466,-71.7575,-72.0617,-72.3773,-72.7039,-73.0426,-73.3935,-73.7436,-74.0978,-74.4638,-74.8378,-75.2227,-75.6188,-76.0144,-76.404,-76.8046,-77.2161,-77.6305,-78.0545,-78.4889,-78.9332,-79.3804,-79.8276,-80.2776,-80.7372,-81.2065,-81.6806,-82.159,-82.6467,-83.142,-83.6427,-84.1522,-84.6705,-85.1974,-85.7327,-86.274,-86.8156,-87.2696,-87.669,-88.078,-88.4963,-88.924,-89.3608,-89.8061,-90.2547,-90.7113,-91.1765,-91.6503,-92.1326,-92.6187,-93.1113,-93.6121,-94.1208,-94.6355,-95.1565,-95.6851,-96.2211,-96.7646,-97.3152,-97.873,-98.4378,-99.0095,-99.5879,-100.17,-100.757,-101.351,-101.95,-102.554,-103.164,-103.78,-104.402,-105.03,-105.664,-106.303,-106.948,-107.598,-108.253,-108.914,-109.58,-110.251,-110.927,-111.608,-112.293,-112.984,-113.679,-114.378,-115.082,-115.789,-116.497,-117.209,-117.925,-118.645,-119.369,-120.097,-120.829,-121.565,-122.305,-123.048,-123.795,-124.546,-125.3,-126.057,-126.816,-127.577,-128.342,-129.109,-129.88,-130.654,-131.431,-132.211,-132.992,-133.776,-134.563,-135.352,-136.145,-136.94,-137.738,-138.538,-139.339,-140.143,-140.95,-141.759,-142.571,-143.132,-143.394,-143.663,-143.938,-144.219,-144.504,-144.783,-145.069,-145.357,-145.651,-145.952,-146.259,-146.572,-146.889,-147.211,-147.54,-147.875,-148.215,-148.562,-148.913,-149.268,-149.629,-149.996,-150.368,-150.746,-151.13,-151.52,-151.915,-152.315,-152.526,-152.701,-152.883,-153.071,-153.265,128.95,127.971,126.993,126.014,125.036,124.059,123.082,122.105,121.129,120.153,119.177,118.202,117.227,116.252,115.278,114.305,113.332,112.359,111.387,110.416,109.445,108.474,107.504,106.535,105.566,104.597,103.63,102.663,101.696,100.73,99.7653,98.8009,97.8372,96.8743,95.9121,94.9506,93.99,93.0302,92.0713,91.1133,90.1561,89.1999,88.2447,87.2905,86.3373,85.3852,84.4341,83.4843,82.5328,81.5784,80.6251,79.6697,78.7148,77.761,76.8083,75.8569,74.9067,73.9578,73.0095,72.0625,71.117,70.1731,69.2306,68.2899,67.3508,66.4135,65.4781,64.5446,63.6131,62.6838,61.7566,60.8318,59.8963,58.9624,58.0307,57.1013,56.1729,55.2462,54.3057,53.3654,52.4272,51.4914,50.558,49.6272,48.6991,47.7507,46.8041,45.8598,44.918,43.9787,43.0421,42.0911,41.1359,40.1828,39.2321,38.2833,37.3355,36.3504,35.3528,34.354,33.3552,32.3565,31.3579,30.3594,29.361,28.3627,27.3646,26.3666,25.3687,24.371,23.3735,22.375,21.375,20.375,19.375,18.375,17.375,16.375,15.375,14.375,13.375,12.375,11.375,10.375,9.375,8.375,7.375,6.375,5.375,4.375,3.375,2.375,1.375,0.375,-0.5625,-1.5625,-2.5625,-3.5625,-4.5625,-5.5625,-6.5625,-7.5625,-8.5625,-9.5625,-10.5625,-11.5625,-12.5625,-13.5625,-14.5625,-15.5625,-16.5625,-17.5625,-18.5625,-19.5625,-20.5625,-21.5625,-22.5625,-23.5625,-24.5625,-25.5625,-26.5625,-27.5625,-28.5625,-29.5625,-30.5625,-31.5625,-32.5625,-33.5625,-34.5625,-35.5625,-36.5625,-37.5625,-38.5625,-39.5625,-40.5625,-41.5625,-42.5625,-43.5625,-44.5625,-45.5625,-46.5625,-47.5625,-48.5625,-49.5625,-50.5625,-51.5625,-52.5625,-53.5625,-54.5625,-55.5625,-56.5625,-57.5625,-58.5625,-59.5625,-60.5625,-61.5625,-62.5625,-63.5625,-64.5625,-65.0568,-65.1081,-65.1634,-65.2267,-65.3052,-65.3951,-65.4935,-65.6069,-65.731,-65.8553,-65.9908,-66.1412,-66.3064,-66.4862,-66.6704,-66.8546,-66.9068,-66.8834,-66.875,-66.875,-66.875,-66.8834,-66.9068,-66.9451,-66.9983,-67.0607,-67.1287,-67.2115,-67.309,-67.4213,-67.5449,-67.679,-67.8225,-67.979,-68.1498,-68.3348,-68.5314,-68.7399,-68.9574,-69.1854,-69.426,-69.6776,-69.9426,-70.2209,-70.5081,-70.8035,-71.1118,-71.4307,-71.7616,-72.1048,-72.4563,-72.807,-73.1658,-73.5354,-73.9135,-74.3031,-74.7041,-75.0921,-75.4864,-75.8918,-76.3053,-76.7235,-77.1524,-77.5919,-78.0388,-78.486,-78.9335,-79.3883,-79.853,-80.3273,-80.8013,-81.2848,-81.7778,-82.2753,-82.7812,-83.296,-83.8196,-84.3518,-84.8924,-85.4324,-85.9577,-86.3516,-86.7553,-87.1685,-87.5912,-88.0233,-88.4645,-88.9117,-89.3639,-89.825,-90.2949,-90.7733,-91.2584,-91.7475,-92.2448,-92.7502,-93.2631,-93.781,-94.3067,-94.84,-95.3808,-95.929,-96.4845,-97.047,-97.6166,-98.1931,-98.7742,-99.3597,-99.9517,-100.55,-101.152,-101.761,-102.376,-102.997,-103.623,-104.256,-104.894,-105.538,-106.188,-106.842,-107.503,-108.168,-108.838,-109.514,-110.194,-110.88,-111.57,-112.264,-112.964,-113.668,-114.375,-115.082,-115.794,-116.511,-117.231,-117.955,-118.684,-119.416,-120.152,-120.892,-121.636,-122.384,-123.134,-123.889,-124.647,-125.406,-126.168,-126.933,-127.701,-128.473,-129.247,-130.025,-130.805,-131.587,-132.372,-133.159,-133.95,-134.743,-135.539,-136.338,-137.138,-137.94,-138.745,-139.553,-140.363,-141.175,-141.909,-142.166,-142.43,-142.701,-142.978,-143.261,-143.543,-143.824,-144.111,-144.401,-144.697,-144.999,-145.308,-145.623,-145.941,-146.266,-146.597,-146.934,-147.277,-147.626,-147.977,-148.335,-148.698,-149.067,-149.442,-149.822,-150.208,-150.6,-150.998,-151.371,-151.541,-151.717,-151.9,-152.089,-152.284,129.157,128.18,127.203,126.226,125.25,124.274,123.299,122.324,121.349,120.375,119.401,118.428,117.455,116.482,115.51,114.539,113.568,112.597,111.627,110.658,109.689,108.72,107.753,106.785,105.819,104.853,103.888,102.923,101.959,100.996,100.033,99.0713,98.1103,97.15,96.1906,95.232,94.2742,93.3173,92.3614,91.4064,90.4523,89.4993,88.5473,87.5964,86.6466,85.6944,84.7403,83.787,82.8312,81.8765,80.9229,79.9704,79.0191,78.069,77.1201,76.1717,75.2247,74.2791,73.3349,72.3922,71.4511,70.5116,69.5738,68.6377,67.7035,66.7711,65.8408,64.9125,63.9864,63.056,62.1214,61.1887,60.2583,59.3298,58.4018,57.4673,56.5264,55.5877,54.6511,53.7167,52.7848,51.8555,50.9129,49.9662,49.0217,48.0794,47.1394,46.202,45.2525,44.2977,43.345,42.3868,41.3871,40.3874,39.3877,38.388,37.3884,36.3887,35.3891,34.3895,33.39,32.3904,31.3909,30.3915,29.392,28.3926,27.3933,26.394,25.3947,24.3955,23.3964,22.3973,21.3984,20.3995,19.4008,18.4022,17.4038,16.4055,15.4075,14.4097,13.4123,12.4153,11.4189,10.4231,9.42818,8.43449,7.4375,6.4375,5.4375,4.4375,3.4375,2.4375,1.4375,0.4375,-0.5625,-1.5625,-2.5625,-3.5625,-4.5625,-5.5625,-6.5625,-7.5625,-8.5625,-9.5625,-10.5625,-11.5625,-12.5625,-13.5625,-14.5625,-15.5625,-16.5625,-17.5625,-18.5625,-19.5625,-20.5625,-21.5625,-22.5625,-23.5625,-24.5625,-25.5625,-26.5625,-27.5625,-28.5625,-29.5625,-30.5625,-31.5625,-32.5625,-33.5625,-34.5625,-35.5625,-36.5625,-37.5625,-38.5625,-39.5625,-40.5625,-41.5625,-42.5625,-43.5625,-44.5625,-45.5625,-46.5625,-47.5625,-48.5625,-49.5625,-50.5625,-51.5625,-52.5625,-53.5625,-54.5625,-55.5625,-56.5625,-57.5625,-58.5625,-59.5625,-60.5625,-61.5625,-62.5625,-63.5625,-64.0049,-64.0586,-64.1098,-64.165,-64.2292,-64.309,-64.3993,-64.4992,-64.6144,-64.7384,-64.8636,-65.0013,-65.154,-65.3216,-65.5041,-65.6882,-65.8723,-65.9073,-65.8836,-65.875,-65.875,-65.875,-65.8836,-65.9073,-65.9461,-66.0001,-66.0625,-66.1316,-66.2156,-66.3147,-66.4286,-66.5531,-66.6891,-66.8339,-66.9927,-67.166,-67.3537,-67.5522,-67.7637,-67.9825,-68.2138,-68.4569,-68.7121,-68.9808,-69.2629,-69.5514,-69.8508,-70.163,-70.4856,-70.8209,-71.1686,-71.5195,-71.8722,-72.2356,-72.6082,-72.9911,-73.3856,-73.7839,-74.1717,-74.5709,-74.9813,-75.3956,-75.8189,-76.2529,-76.6972,-77.1443,-77.5916,-78.0417,-78.5016,-78.9715,-79.4456,-79.9248,-80.4136,-80.9095,-81.4116,-81.9228,-82.443,-82.972,-83.5096,-84.0503,-84.5943,-85.0374,-85.4355,-85.8435,-86.2611,-86.6882,-87.1248,-87.57,-88.0187,-88.4755,-88.9412,-89.4157,-89.8987,-90.3851,-90.8789,-91.3809,-91.8911,-92.4067,-92.9294,-93.4599,-93.998,-94.5437,-95.0967,-95.657,-96.2244,-96.7988,-97.3793,-97.9629,-98.5531,-99.15,-99.7513,-100.358,-100.972,-101.591,-102.217,-102.848,-103.486,-104.129,-104.777,-105.432,-106.091,-106.756,-107.426,-108.101,-108.781,-109.466,-110.156,-110.85,-111.55,-112.253,-112.96,-113.668,-114.38,-115.097,-115.817,-116.542,-117.27,-118.003,-118.74,-119.48,-120.224,-120.972,-121.723,-122.478,-123.237,-123.996,-124.759,-125.524,-126.293,-127.065,-127.841,-128.619,-129.4,-130.182,-130.968,-131.756,-132.547,-133.341,-134.138,-134.938,-135.738,-136.542,-137.348,-138.156,-138.967,-139.781,-140.597,-140.942,-141.201,-141.467,-141.739,-142.018,-142.303,-142.583,-142.866,-143.153,-143.445,-143.743,-144.048,-144.358,-144.674,-144.995,-145.322,-145.655,-145.994,-146.339,-146.689,-147.043,-147.402,-147.768,-148.139,-148.516,-148.899,-149.288,-149.682,-150.082,-150.385,-150.556,-150.734,-150.918,-151.108,-151.304,129.372,128.396,127.421,126.446,125.472,124.497,123.524,122.55,121.578,120.605,119.633,118.662,117.691,116.72,115.75,114.781,113.812,112.843,111.875,110.908,109.941,108.975,108.01,107.045,106.081,105.117,104.154,103.192,102.231,101.27,100.31,99.351,98.3927,97.4352,96.4786,95.5229,94.5681,93.6142,92.6613,91.7095,90.7586,89.8088,88.8561,87.9021,86.9484,85.9928,85.0383,84.0849,83.1325,82.1813,81.2312,80.2824,79.334,78.3869,77.4412,76.4968,75.5538,74.6124,73.6725,72.7342,71.7975,70.8626,69.9295,68.9982,68.069,67.1417,66.216,65.2806,64.3472,63.4158,62.4865,61.5581,60.6289,59.6876,58.7483,57.811,56.8759,55.9429,55.0124,54.0752,53.1284,52.1836,51.2409,50.3003,49.3622,48.4139,47.4172,46.4181,45.4191,44.42,43.4211,42.4222,41.4233,40.4245,39.4258,38.4271,37.4285,36.4299,35.4315,34.4331,33.4349,32.4367,31.4375,30.4375,29.4375,28.4375,27.4375,26.4375,25.4375,24.4375,23.4375,22.4375,21.4375,20.4375,19.4375,18.4375,17.4375,16.4375,15.4375,14.4375,13.4375,12.4375,11.4375,10.4375,9.4375,8.4375,7.4375,6.4375,5.4375,4.4375,3.4375,2.4375,1.4375,0.4375,-0.5625,-1.5625,-2.5625,-3.5625,-4.5625,-5.5625,-6.5625,-7.5625,-8.5625,-9.5625,-10.5625,-11.5625,-12.5625,-13.5625,-14.5625,-15.5625,-16.5625,-17.5625,-18.5625,-19.5625,-20.5625,-21.5625,-22.5625,-23.5625,-24.5625,-25.5625,-26.5625,-27.5625,-28.5625,-29.5625,-30.5625,-31.5625,-32.5625,-33.5625,-34.5625,-35.5625,-36.5625,-37.5625,-38.5625,-39.5625,-40.5625,-41.5625,-42.5625,-43.5625,-44.5625,-45.5625,-46.5625,-47.5625,-48.5625,-49.5625,-50.5625,-51.5625,-52.5625,-53.5625,-54.5625,-55.5625,-56.5625,-57.5625,-58.5625,-59.5625,-60.5625,-61.5625,-62.5625,-62.9557,-63.006,-63.06,-63.1115,-63.1666,-63.2319,-63.3129,-63.4036,-63.5051,-63.6221,-63.7461,-63.8722,-64.012,-64.1671,-64.3373,-64.5218,-64.7064,-64.8906,-64.9078,-64.8837,-64.875,111.512,110.516,109.52,108.524,107.529,106.533,105.537,104.542,103.547,102.551,101.556,100.561,99.566,98.5711,97.5763,96.5811,95.5859,94.5907,93.5957,92.6008,91.606,90.6113,89.6167,88.6223,87.6279,25.2048,-26.1792,-27.1519,-28.1265,-29.1029,-30.0808,-31.06,-32.0406,-33.0211,-33.9971,-34.9739,-35.9521,-36.9314,-37.9117,-38.8931,-39.8754,-40.8586,-41.8426,-42.8273,-43.8127,-44.7987,-45.7842,-46.7674,-47.7513,-48.7359,-49.7127,-50.6875,-51.6633,-52.6401,-53.6176,-54.596,-55.5752,-56.5551,-57.5341,-58.5111,-59.4889,-60.4674,-61.4465,-62.4264,-63.4068,-64.3879,-65.3695,-66.3487,-67.3188,-68.2889,-69.2595,-70.2309,-71.2031,-72.1676,-73.1277,-74.0889,-75.0511,-76.0142,-76.9783,-77.9433,-78.9036,-79.8536,-80.799,-81.7457,-82.6936,-83.6423,-84.5912,-85.5396,-86.4883,-87.4377,-88.3882,-89.3398,-90.2925,-91.2461,-92.2007,-93.1563,-94.1128,-95.068,-96.0237,-96.9803,-97.9377,-98.896,-99.8551,-100.815,-101.775,-102.733,-103.693,-104.653,-105.613,-106.575,-107.536,-108.498,-109.46,-110.423,-111.387,-112.351,-113.316,-114.282,-115.248,-116.214,-117.182,-118.149,-119.118,-120.087,-121.056,-122.026,-122.996,-123.966,-124.936,-125.906,-126.877,-127.848,-128.82,-129.792,-130.764,-131.737,-132.71,-133.684,-134.658,-135.633,-136.607,-137.582,-138.558,-139.534,-140.51,-141.486,-142.463,-143.44,-144.418,-145.396,-146.374,-147.352,-148.331,-149.31,-150.289,-151.269,-152.248,-153.228,-154.209,-155.189,-156.17,-157.151,-158.132,-159.114,-160.095,-161.077,-162.06,-163.042,-164.025,-165.007,-165.99,-166.974,-167.957,-168.941,-169.924,-170.908,-171.893,-172.877,-173.861,-174.846,-175.831,-176.769,-177.55,-178.332,-179.116,-179.902,-180.69,-181.481,-182.273,-182.76,-183.093,-183.431,-183.773,-184.121,-184.472,-184.817,-185.167,-185.521,-185.88,-186.244,-186.612,-186.977,-187.332,-187.564,-187.781,-188.001,-188.227,-188.458,-188.694,-188.896,-189.068,-189.244,-189.426,-189.612,-189.804,-190.,-190.2,-190.405,-190.616,-190.831,-191.051,-191.277,-191.507};
 
 #include "ArrayAlgebra.h"
-#include "Interpolation.h"
+#include "EnvironmentData.h"
 
 namespace WaterWavelets 
 {
-	auto& raw_data = harbor_data;
-	//  raw_data ƽ֮ĴС
-	const int N = sqrt(raw_data.size());
-
-	auto data_grid = [](int i, int j)->float {
-		// жi j ǷΧ
-		if (i < 0 || i >= N || j < 0 || j >= N)
-			return 100;
-		// ƽ
-		return raw_data[j + i * N];
-	};
-	// ֮Ĳֵ
-	auto dy_data_grid = [](int i, int j)->float {
-		if (i < 0 || i >= N || j < 0 || j >= (N - 1))
-			return 0;
-		return raw_data[(j + 1) + i * N] - raw_data[j + i * N];
-	};
-
-	auto igrid = InterpolationDimWise(LinearInterpolation, LinearInterpolation)(data_grid);
-
-	auto igrid_dx = InterpolationDimWise(LinearInterpolation,
-		LinearInterpolation)(dy_data_grid);
-
-	auto igrid_dy = InterpolationDimWise(LinearInterpolation,
-		LinearInterpolation)(dy_data_grid);
-
-	auto grid = [](Vec2 pos, float dx)->float {
-		pos *= 1 / dx;
-		pos += Vec2{ N / 2 - 0.5f,N / 2 - 0.5f };
-		return igrid(pos[0], pos[1]) * dx;
-	};
-	auto grid_dx = [](Vec2 pos, float dx) -> float {
-		pos *= 1 / dx;
-		pos += Vec2{ N / 2 - 1.0f, N / 2 - 0.5f };
-		return igrid_dx(pos[0], pos[1]);
-	};
+	// Round island in open water, its exact signed distance in cells of a 128 x 128 table
+	inline std::vector<float> islandMap() {
+		const int n = 128;
+		std::vector<float> table(n * n);
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++)
+				table[j + i * n] = std::hypot(i - 80.f, j - 48.f) - 12;
+		return table;
+	}
 
-	auto grid_dy = [](Vec2 pos, float dx) -> float {
-		pos *= 1 / dx;
-		pos += Vec2{ N / 2 - 0.5f, N / 2 - 1.0f };
-		return igrid_dy(pos[0], pos[1]);
-	};
+	// Registers the maps shipped with the sources, safe to call repeatedly
+	inline EnvironmentRegistry& environments() {
+		static const bool builtin = [] {
+			EnvironmentRegistry::instance().add("harbor", [] { return harbor_data; }, 3);
+			EnvironmentRegistry::instance().add("island", islandMap, 3);
+			return true;
+		}();
+		(void)builtin;
+		return EnvironmentRegistry::instance();
+	}
 
 	class Environment 
 	{
 	public:
-		Environment(float size) :_dx((2 * size) / N) {}
+		/*
+		 * Environment of the registered map `name`, covering the map's own
+		 * extent. For positive `resolution` the coarsest precomputed level
+		 * whose cells are not larger than `resolution` is used. An unknown
+		 * name is reported and gives open water, @see valid().
+		 */
+		Environment(std::string const& name = "harbor", float resolution = 0)
+			: Environment(environments().get(name), resolution) {
+			if (!m_valid)
+				std::cout << "ERROR::ENVIRONMENT::UNKNOWN: " << name << std::endl;
+		}
+
+		Environment(std::shared_ptr<const EnvironmentData> data, float resolution = 0)
+			: m_data(data ? data : openWater()), m_valid(data != nullptr) {
+
+			float dx0 = (2 * m_data->extent()) / m_data->level(0).n;
+			int   l = 0;
+			while (resolution > 0 && l + 1 < m_data->levels() &&
+				dx0 * m_data->level(l + 1).scale <= resolution)
+				l++;
+
+			m_level = &m_data->level(l);
+			_dx = dx0 * m_level->scale;
+		}
 
 		bool inDomain(Vec2 pos)const {
 			return levelset(pos) >= 0;
 		}
 		Real levelset(Vec2 pos)const {
-			return grid(pos, _dx);
+			return sample(pos).first;
 		}
 		Vec2 levelsetGrad(Vec2 pos)const {
-			Vec2 grad = Vec2{ grid_dx(pos, _dx), grid_dy(pos, _dx) };
-			return normalized(grad);
+			return normalized(sample(pos).second);
 		}
 
+		/*
+		 * Levelset value and gradient at `pos` from a single 2x2 fetch of the
+		 * levelset table. The gradient is the exact derivative of the bilinear
+		 * interpolant, i.e. it is not normalized.
+		 */
+		std::pair<Real, Vec2> sample(Vec2 pos)const {
+			const int N = m_level->n;
+			Real gx = pos[0] * (1 / _dx) + m_level->offset;
+			Real gy = pos[1] * (1 / _dx) + m_level->offset;
+			int ix = (int)floor(gx);
+			int iy = (int)floor(gy);
+			Real wx = gx - ix;
+			Real wy = gy - iy;
+
+			Real f00, f01, f10, f11;
+			if (ix >= 0 && ix + 1 < N && iy >= 0 && iy + 1 < N) {
+				const float* p = &m_level->data[iy + ix * N];
+				f00 = p[0];
+				f01 = p[1];
+				f10 = p[N];
+				f11 = p[N + 1];
+			}
+			else {
+				f00 = m_level->at(ix, iy);
+				f01 = m_level->at(ix, iy + 1);
+				f10 = m_level->at(ix + 1, iy);
+				f11 = m_level->at(ix + 1, iy + 1);
+			}
+
+			Real d0 = f10 - f00;
+			Real d1 = f11 - f01;
+			Real value = (1 - wy) * (f00 + wx * d0) + wy * (f01 + wx * d1);
+			Vec2 grad = { (1 - wy) * d0 + wy * d1, (f01 - f00) + wx * (d1 - d0) };
+
+			// levelset is scaled by `_dx` and so is its argument, the gradient is not
+			return { value * _dx, grad };
+		}
+
+		/*
+		 * Batched `sample` over a row of query points `pos0 + i * step` for
+		 * i = 0,...,count-1, results are written to `out[i]`.
+		 */
+		void sampleRow(Vec2 pos0, Vec2 step, int count, std::pair<Real, Vec2>* out)const {
+			for (int i = 0; i < count; i++) {
+				out[i] = sample(Vec2{ pos0[0] + i * step[0], pos0[1] + i * step[1] });
+			}
+		}
+
+		// Shared levelset tables, the same object for all users of one map
+		std::shared_ptr<const EnvironmentData> const& data()const {
+			return m_data;
+		}
+		// False if the map was unknown and this is open water instead
+		bool valid()const {
+			return m_valid;
+		}
+
+	private:
+		// Map without land, every point is far from the coast
+		static std::shared_ptr<const EnvironmentData> openWater() {
+			static auto water = std::make_shared<const EnvironmentData>(std::vector<float>(4, 100.f));
+			return water;
+		}
+
+		std::shared_ptr<const EnvironmentData> m_data;
+		bool m_valid;
+		EnvironmentData::Level const* m_level;
+
 	public:
+		// Cell size of the levelset level in use
 		float _dx;
 	};
 }
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "Global.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Immutable levelset table of one map.
+	 *
+	 * Level 0 is the signed distance field as given, stored as an N x N table
+	 * in units of its own cells. Level l > 0 is a 2x2 average of level l-1 and
+	 * is meant for grids much coarser than the table itself. The table covers
+	 * the world square [-extent, extent]^2 whatever the grids sampling it
+	 * cover, a grid smaller than the map sees the part of it under the grid.
+	 *
+	 * Instances are shared between `Environment`s through `EnvironmentRegistry`
+	 * and never change after construction.
+	 */
+	class EnvironmentData
+	{
+	public:
+		struct Level {
+			// Table value, points outside of the table are far away from land
+			float at(int i, int j)const {
+				if (i < 0 || i >= n || j < 0 || j >= n)
+					return 100;
+				return data[j + i * n];
+			}
+
+			int n;
+			// Number of level 0 cells per cell of this level
+			int scale;
+			// Grid coordinate of the physical origin
+			float offset;
+			std::vector<float> data;
+		};
+
+	public:
+		EnvironmentData(std::vector<float> const& raw_data, int mipLevels = 0, float extent = 50)
+			: m_extent(extent) {
+			const int N = sqrt(raw_data.size());
+			m_levels.push_back(Level{ N, 1, N / 2 - 0.5f,
+				std::vector<float>(raw_data.begin(), raw_data.begin() + N * N) });
+
+			for (int l = 1; l <= mipLevels && m_levels.back().n >= 4; l++) {
+				Level const& fine = m_levels.back();
+				Level coarse{ fine.n / 2, 2 * fine.scale, 0.5f * (fine.offset + 0.5f) - 0.5f, {} };
+				coarse.data.resize(coarse.n * coarse.n);
+				for (int i = 0; i < coarse.n; i++) {
+					for (int j = 0; j < coarse.n; j++) {
+						// average of the four children, halved because cells are twice as big
+						coarse.data[j + i * coarse.n] = 0.125f *
+							(fine.at(2 * i, 2 * j) + fine.at(2 * i + 1, 2 * j) +
+								fine.at(2 * i, 2 * j + 1) + fine.at(2 * i + 1, 2 * j + 1));
+					}
+				}
+				m_levels.push_back(std::move(coarse));
+			}
+		}
+
+		int levels()const {
+			return m_levels.size();
+		}
+		Level const& level(int l)const {
+			return m_levels[l];
+		}
+		// Half the side of the world square covered by the table
+		float extent()const {
+			return m_extent;
+		}
+
+		// FNV-1a hash of the level 0 table, identifies the map across runs
+		std::uint32_t fingerprint()const {
+			auto const& data = m_levels[0].data;
+			auto bytes = reinterpret_cast<unsigned char const*>(data.data());
+			std::uint32_t hash = 2166136261u;
+			for (std::size_t i = 0; i < data.size() * sizeof(float); i++) {
+				hash ^= bytes[i];
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+
+	private:
+		std::vector<Level> m_levels;
+		float m_extent;
+	};
+
+	/*
+	 * Process wide registry of named maps.
+	 *
+	 * A map is built on the first `get` and shared by everyone asking for the
+	 * same name for as long as somebody holds it. Once the last holder is gone
+	 * the table is freed and rebuilt by the loader on the next `get`.
+	 */
+	class EnvironmentRegistry
+	{
+	public:
+		using Loader = std::function<std::vector<float>()>;
+
+		static EnvironmentRegistry& instance() {
+			static EnvironmentRegistry registry;
+			return registry;
+		}
+
+		/*
+		 * Registers map `name`, `loader` returns the raw N x N levelset table
+		 * covering [-extent, extent]^2 and `mipLevels` is the number of coarse
+		 * levels to precompute. Registering an existing name replaces it for
+		 * future `get`s only.
+		 */
+		void add(std::string const& name, Loader loader, int mipLevels = 0, float extent = 50) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			m_entries[name] = Entry{ loader, mipLevels, extent, {} };
+		}
+
+		bool contains(std::string const& name) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			return m_entries.count(name) != 0;
+		}
+
+		// Returns the shared map `name` or nullptr if no such map is registered
+		std::shared_ptr<const EnvironmentData> get(std::string const& name) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto it = m_entries.find(name);
+			if (it == m_entries.end())
+				return nullptr;
+
+			Entry& entry = it->second;
+			auto data = entry.instance.lock();
+			if (!data) {
+				data = std::make_shared<const EnvironmentData>(entry.loader(), entry.mipLevels, entry.extent);
+				entry.instance = data;
+			}
+			return data;
+		}
+
+	private:
+		EnvironmentRegistry() = default;
+
+		struct Entry {
+			Loader loader;
+			int mipLevels;
+			float extent;
+			std::weak_ptr<const EnvironmentData> instance;
+		};
+
+		std::mutex m_mutex;
+		std::map<std::string, Entry> m_entries;
+	};
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Platform.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Runs independent work items in parallel.
+	 *
+	 * `parallelFor(count, body)` calls body(i) for every i in [0,count) and
+	 * returns once all calls are done. Items with lower i are started first,
+	 * so callers put their most expensive items at the front.
+	 */
+	class Executor
+	{
+	public:
+		virtual ~Executor() = default;
+		virtual void parallelFor(int count, std::function<void(int)> const& body) = 0;
+		virtual int concurrency()const = 0;
+	};
+
+	class SerialExecutor : public Executor
+	{
+	public:
+		void parallelFor(int count, std::function<void(int)> const& body) override {
+			for (int i = 0; i < count; i++)
+				body(i);
+		}
+		int concurrency()const override {
+			return 1;
+		}
+	};
+
+	// Static OpenMP schedule, the behaviour of the plain `omp parallel for` loops
+	class OpenMPExecutor : public Executor
+	{
+	public:
+		void parallelFor(int count, std::function<void(int)> const& body) override {
+#pragma omp parallel for schedule(static)
+			for (int i = 0; i < count; i++)
+				body(i);
+		}
+		int concurrency()const override {
+			return std::max(1u, std::thread::hardware_concurrency());
+		}
+	};
+
+	/*
+	 * Pool of threads balancing uneven items by work stealing.
+	 *
+	 * Items are dealt round-robin to one queue per thread, the calling thread
+	 * included, so every queue starts with the expensive front items. A
+	 * thread takes items from the front of its own queue and, once that is
+	 * empty, steals from the back of the others, i.e. the cheap items. A
+	 * queue is a fixed list of items with a [head, tail) window in one atomic
+	 * word, owner and thieves both take items with a compare-exchange on it.
+	 *
+	 * Calls made while the pool is busy, e.g. from inside an item or from a
+	 * second thread, run serially on the calling thread.
+	 *
+	 * Worker i is pinned to cpus[i % cpus.size()] unless `cpus` is empty.
+	 * The calling thread is the owner's to pin, see pinCurrentThread().
+	 */
+	class WorkStealingExecutor : public Executor
+	{
+	public:
+		explicit WorkStealingExecutor(int threads = std::thread::hardware_concurrency(), std::vector<int> cpus = {})
+			: m_queues(std::max(1, threads)), m_cpus(std::move(cpus)) {
+			for (int q = 1; q < (int)m_queues.size(); q++)
+				m_threads.emplace_back([this, q] { workerLoop(q); });
+		}
+
+		~WorkStealingExecutor() {
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_stop = true;
+			}
+			m_start.notify_all();
+			for (auto& thread : m_threads)
+				thread.join();
+		}
+
+		void parallelFor(int count, std::function<void(int)> const& body) override {
+			if (count <= 1 || m_threads.empty() || m_busy.exchange(true, std::memory_order_acquire)) {
+				for (int i = 0; i < count; i++)
+					body(i);
+				return;
+			}
+
+			const int P = m_queues.size();
+			for (auto& queue : m_queues)
+				queue.items.clear();
+			for (int i = 0; i < count; i++)
+				m_queues[i % P].items.push_back(i);
+			for (auto& queue : m_queues)
+				queue.window.store(window(0, queue.items.size()), std::memory_order_relaxed);
+			m_body = &body;
+			m_remaining.store(count, std::memory_order_relaxed);
+
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_open = true;
+				m_generation++;
+			}
+			m_start.notify_all();
+
+			work(0);
+
+			// no thread may join anymore, wait for those still working
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_open = false;
+			}
+			while (m_remaining.load(std::memory_order_acquire) > 0 || m_active.load(std::memory_order_acquire) > 0)
+				std::this_thread::yield();
+
+			m_body = nullptr;
+			m_busy.store(false, std::memory_order_release);
+		}
+
+		int concurrency()const override {
+			return m_queues.size();
+		}
+
+	private:
+		struct alignas(64) Queue {
+			std::vector<int> items;
+			std::atomic<std::uint64_t> window{ 0 };
+		};
+
+		static std::uint64_t window(std::uint32_t head, std::uint32_t tail) {
+			return (std::uint64_t(tail) << 32) | head;
+		}
+
+		void workerLoop(int q) {
+			if (!m_cpus.empty())
+				pinCurrentThread(m_cpus[(q - 1) % m_cpus.size()]);
+			std::uint64_t seen = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_start.wait(lock, [&] { return m_stop || m_generation != seen; });
+					if (m_stop)
+						return;
+					seen = m_generation;
+					if (!m_open)
+						continue;
+					m_active.fetch_add(1, std::memory_order_relaxed);
+				}
+				work(q);
+				m_active.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		void work(int q) {
+			int item;
+			while (take(q, item) || steal(q, item)) {
+				(*m_body)(item);
+				m_remaining.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		// front of the own queue
+		bool take(int q, int& item) {
+			Queue& queue = m_queues[q];
+			std::uint64_t w = queue.window.load(std::memory_order_acquire);
+			while (true) {
+				std::uint32_t head = w, tail = w >> 32;
+				if (head >= tail)
+					return false;
+				if (queue.window.compare_exchange_weak(w, window(head + 1, tail), std::memory_order_acq_rel)) {
+					item = queue.items[head];
+					return true;
+				}
+			}
+		}
+
+		// back of the other queues
+		bool steal(int q, int& item) {
+			const int P = m_queues.size();
+			for (int k = 1; k < P; k++) {
+				Queue& queue = m_queues[(q + k) % P];
+				std::uint64_t w = queue.window.load(std::memory_order_acquire);
+				while (true) {
+					std::uint32_t head = w, tail = w >> 32;
+					if (head >= tail)
+						break;
+					if (queue.window.compare_exchange_weak(w, window(head, tail - 1), std::memory_order_acq_rel)) {
+						item = queue.items[tail - 1];
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		std::vector<Queue> m_queues;
+		std::vector<std::thread> m_threads;
+		std::vector<int> m_cpus;
+		std::function<void(int)> const* m_body = nullptr;
+		std::atomic<int> m_remaining{ 0 };
+		std::atomic<int> m_active{ 0 };
+		std::atomic<bool> m_busy{ false };
+
+		// start of a parallelFor and shutdown
+		std::mutex m_mutex;
+		std::condition_variable m_start;
+		std::uint64_t m_generation = 0;
+		bool m_open = false;
+		bool m_stop = false;
+	};
+
+	// Executor used by grids and profile buffers unless told otherwise, @see placementPolicy()
+	inline Executor& defaultExecutor() {
+		static WorkStealingExecutor executor(std::thread::hardware_concurrency(), placementPolicy().worker_cpus);
+		return executor;
+	}
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cassert>
+
 #include "Global.h"
+#include "Platform.h"
 namespace WaterWavelets 
 {
 	class Grid
@@ -8,15 +11,60 @@ namespace WaterWavelets
 	public:
 		Grid();
 		void resize(int n0, int n1, int n2, int n3);
-		Real& operator()(int i0, int i1, int i2, int i3);
+		/*
+		 * `resize` without zeroing, new values are uninitialized. The pages of
+		 * the storage are placed where the values are written first, so an
+		 * owner writing them with the threads that later work on them gets
+		 * memory local to those threads.
+		 */
+		void allocate(int n0, int n1, int n2, int n3);
+		// Inline, the passes call them for every node and direction
+		Real& operator()(int i0, int i1, int i2, int i3) {
+			return m_data[index(i0, i1, i2, i3)];
+		}
 
-		Real const& operator()(int i0, int i1, int i2, int i3)const;
+		Real const& operator()(int i0, int i1, int i2, int i3)const {
+			return m_data[index(i0, i1, i2, i3)];
+		}
 
-		int dimension(int dim)const;
+		int dimension(int dim)const {
+			return m_dimensions[dim];
+		}
+
+		/*
+		 * Toroidal shift of the first two dimensions: logical index (i0,i1)
+		 * afterwards refers to what was (i0 + s0, i1 + s1) before. No data is
+		 * moved, the cells wrapping around keep stale values.
+		 */
+		void roll(int s0, int s1);
+
+		/*
+		 * Raw storage in storage order, i.e. without the shift of `roll`.
+		 * Together with `origin()` it describes the content completely.
+		 */
+		Real* data();
+		Real const* data()const;
+		int size()const;
+
+		// Current toroidal shift, `roll(origin()[0], origin()[1])` reproduces it on a fresh grid
+		std::array<int, 2> origin()const;
 
 	private:
+		// Storage index of logical (i0,i1,i2,i3), a grid that was never rolled skips the wrap
+		int index(int i0, int i1, int i2, int i3)const {
+			assert(i0 >= 0 && i0 < dimension(0) && i1 >= 0 && i1 < dimension(1) &&
+				i2 >= 0 && i2 < dimension(2) && i3 >= 0 && i3 < dimension(3));
+			if ((m_origin[0] | m_origin[1]) != 0) {
+				i0 += m_origin[0];
+				i1 += m_origin[1];
+				if (i0 >= dimension(0)) i0 -= dimension(0);
+				if (i1 >= dimension(1)) i1 -= dimension(1);
+			}
+			return i3 + dimension(3) * (i2 + dimension(2) * (i1 + dimension(1) * i0));
+		}
+
 		// 
-		std::vector<Real> m_data;
+		std::vector<Real, AlignedAllocator<Real>> m_data;
 		
 		/*
 		ֱĸάȵݣǵĳȲһ
@@ -26,6 +74,9 @@ namespace WaterWavelets
 		ĸk              
 		*/
 		std::array<int, 4> m_dimensions;
+
+		// storage index of logical (0,0) in the first two dimensions
+		std::array<int, 2> m_origin;
 	};
 
 }
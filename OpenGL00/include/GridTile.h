@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <vector>
+
+#include "Global.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Rectangular window of a wave grid addressed with the grid's own indices.
+	 *
+	 * Holds the nodes [ix0,ix1) x [iy0,iy1) with all theta and zeta, laid out
+	 * like `Grid` so a node's theta x zeta block is contiguous. Used as a
+	 * small, cache resident working copy of part of a grid.
+	 */
+	class GridTile
+	{
+	public:
+		// `range` is {ix0, ix1, iy0, iy1}, the content is undefined afterwards
+		void resize(std::array<int, 4> const& range, int ntheta, int nzeta) {
+			m_range = range;
+			m_ny = range[3] - range[2];
+			m_ntheta = ntheta;
+			m_nzeta = nzeta;
+			m_data.resize((range[1] - range[0]) * m_ny * ntheta * nzeta);
+		}
+
+		bool contains(int ix, int iy)const {
+			return ix >= m_range[0] && ix < m_range[1] && iy >= m_range[2] && iy < m_range[3];
+		}
+
+		Real& operator()(int ix, int iy, int itheta, int izeta) {
+			return m_data[index(ix, iy, itheta, izeta)];
+		}
+		Real const& operator()(int ix, int iy, int itheta, int izeta)const {
+			return m_data[index(ix, iy, itheta, izeta)];
+		}
+
+		std::array<int, 4> const& range()const {
+			return m_range;
+		}
+
+	private:
+		int index(int ix, int iy, int itheta, int izeta)const {
+			assert(contains(ix, iy) && itheta >= 0 && itheta < m_ntheta && izeta >= 0 && izeta < m_nzeta);
+			return izeta + m_nzeta * (itheta + m_ntheta * ((iy - m_range[2]) + m_ny * (ix - m_range[0])));
+		}
+
+		std::array<int, 4> m_range = { 0, 0, 0, 0 };
+		int m_ny = 0;
+		int m_ntheta = 0;
+		int m_nzeta = 0;
+		std::vector<Real> m_data;
+	};
+}
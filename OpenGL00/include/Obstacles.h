@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "ArrayAlgebra.h"
+#include "Global.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Moving obstacle, e.g. a ship hull or a floating barrier.
+	 *
+	 * The shape is an oriented box with rounded corners: a box with half
+	 * extents `halfSize` rotated by `angle` around `position` and inflated by
+	 * `radius`. A zero `halfSize` gives a disc.
+	 */
+	struct Obstacle {
+		Vec2 position = { 0, 0 };
+		Real angle = 0;
+		Vec2 halfSize = { 1, 1 };
+		Real radius = 0;
+
+		// Signed distance, positive in water and negative inside the obstacle
+		Real levelset(Vec2 pos)const {
+			Vec2 d = pos - position;
+			Real c = cosf(angle);
+			Real s = sinf(angle);
+			Vec2 q = { fabsf(c * d[0] + s * d[1]) - halfSize[0],
+					   fabsf(-s * d[0] + c * d[1]) - halfSize[1] };
+
+			Real outside = hypotf(std::max(q[0], Real(0)), std::max(q[1], Real(0)));
+			Real inside = std::min(std::max(q[0], q[1]), Real(0));
+			return outside + inside - radius;
+		}
+
+		// Radius of a disc around `position` containing the whole obstacle
+		Real boundingRadius()const {
+			return norm(halfSize) + radius;
+		}
+
+		bool operator==(Obstacle const& o)const {
+			return position == o.position && angle == o.angle &&
+				halfSize == o.halfSize && radius == o.radius;
+		}
+	};
+
+	/*
+	 * Levelset of all obstacles cached on the nodes of a wave grid.
+	 *
+	 * Every node stores the minimum of the obstacle levelsets clamped to
+	 * `band`, nodes further than `band` from every obstacle just hold `band`.
+	 * `update()` recomputes only the nodes in the swept footprint of obstacles
+	 * that changed since the previous call, i.e. the union of their old and
+	 * new bounding boxes grown by `band`.
+	 */
+	class ObstacleLayer
+	{
+	public:
+		/*
+		 * Sets up the node grid: n x n nodes, node (ix,iy) sits at
+		 * xmin + (i + 0.5) * dx. All obstacles are kept.
+		 */
+		void resize(int n, Vec2 xmin, Real dx, Real band) {
+			m_n = n;
+			m_xmin = xmin;
+			m_dx = dx;
+			m_band = band;
+			m_levelset.assign(n * n, band);
+			m_pending.clear();
+			m_freed.clear();
+			for (auto& e : m_entries)
+				e.drawn = false;
+		}
+
+		/*
+		 * Moves the node grid to a new origin by whole nodes. Only the
+		 * footprints drawn so far move along with it, obstacles are redrawn
+		 * on the next `update()`, which also reports them as dirty.
+		 */
+		void setOrigin(Vec2 xmin) {
+			const int sx = (int)round((xmin[0] - m_xmin[0]) / m_dx);
+			const int sy = (int)round((xmin[1] - m_xmin[1]) / m_dx);
+			std::vector<std::pair<int, Real>> moved;
+			std::vector<Obstacle> cleared;
+			for (auto& e : m_entries) {
+				if (!e.drawn)
+					continue;
+				auto r = footprint(e.last);
+				for (int ix = r[0]; ix < r[1]; ix++) {
+					for (int iy = r[2]; iy < r[3]; iy++) {
+						Real& ls = m_levelset[iy + ix * m_n];
+						int jx = ix - sx, jy = iy - sy;
+						if (ls < m_band && jx >= 0 && jx < m_n && jy >= 0 && jy < m_n)
+							moved.push_back({ jy + jx * m_n, ls });
+						ls = m_band;
+					}
+				}
+				cleared.push_back(e.last);
+				e.drawn = false;
+			}
+			// land stays land until `update()`, so it can tell the nodes that get free
+			for (auto [i, ls] : moved)
+				m_levelset[i] = std::min(m_levelset[i], ls);
+			m_xmin = xmin;
+			for (auto const& obstacle : cleared)
+				m_pending.push_back(footprint(obstacle));
+			m_version++;
+		}
+
+		// Adds an obstacle and returns its id, it takes effect on next `update()`
+		int add(Obstacle const& obstacle) {
+			m_entries.push_back(Entry{ obstacle, obstacle, true, false });
+			return m_entries.size() - 1;
+		}
+		void set(int id, Obstacle const& obstacle) {
+			m_entries[id].current = obstacle;
+		}
+		void remove(int id) {
+			m_entries[id].active = false;
+		}
+
+		/*
+		 * Takes over the obstacles of `source`, with the same ids. Used by
+		 * nested grids to follow the obstacles of the grid they are in, it
+		 * takes effect on the next `update()` like any other change.
+		 */
+		void follow(ObstacleLayer const& source) {
+			for (int id = 0; id < source.size(); id++) {
+				if (id == size())
+					add(source.get(id));
+				m_entries[id].current = source.get(id);
+				m_entries[id].active = source.active(id);
+			}
+		}
+		Obstacle const& get(int id)const {
+			return m_entries[id].current;
+		}
+
+		// Number of ids handed out so far, removed obstacles included
+		int size()const {
+			return m_entries.size();
+		}
+		bool active(int id)const {
+			return m_entries[id].active;
+		}
+
+		bool empty()const {
+			return m_active == 0;
+		}
+
+		// Incremented whenever `update()` or `setOrigin()` changes the cache
+		int version()const {
+			return m_version;
+		}
+
+		/*
+		 * Brings the node cache up to date with the current obstacles and
+		 * returns the number of nodes recomputed.
+		 */
+		int update() {
+			std::vector<std::array<int, 4>> dirty;
+			dirty.swap(m_pending);
+			m_active = 0;
+			for (auto& e : m_entries) {
+				bool changed = e.active != e.drawn || !(e.current == e.last);
+				if (changed && e.drawn)
+					dirty.push_back(footprint(e.last));
+				if (changed && e.active)
+					dirty.push_back(footprint(e.current));
+				e.last = e.current;
+				e.drawn = e.active;
+				m_active += e.active;
+			}
+
+			// the ranges may overlap, so the land is gathered before any node changes
+			m_freed.clear();
+			for (auto const& r : dirty)
+				for (int ix = r[0]; ix < r[1]; ix++)
+					for (int iy = r[2]; iy < r[3]; iy++)
+						if (m_levelset[iy + ix * m_n] < 0)
+							m_freed.push_back({ ix, iy });
+
+			int count = 0;
+			for (auto const& r : dirty) {
+				for (int ix = r[0]; ix < r[1]; ix++) {
+					for (int iy = r[2]; iy < r[3]; iy++) {
+						Vec2 pos = nodePosition(ix, iy);
+						Real ls = m_band;
+						for (auto const& e : m_entries) {
+							if (e.active && norm(pos - e.current.position) <
+								e.current.boundingRadius() + m_band)
+								ls = std::min(ls, e.current.levelset(pos));
+						}
+						m_levelset[iy + ix * m_n] = ls;
+					}
+				}
+				count += (r[1] - r[0]) * (r[3] - r[2]);
+			}
+			if (!dirty.empty())
+				m_version++;
+			m_dirty = std::move(dirty);
+
+			std::sort(m_freed.begin(), m_freed.end());
+			m_freed.erase(std::unique(m_freed.begin(), m_freed.end()), m_freed.end());
+			m_freed.erase(std::remove_if(m_freed.begin(), m_freed.end(), [&](std::array<int, 2> node) {
+				return m_levelset[node[1] + node[0] * m_n] < 0;
+			}), m_freed.end());
+			return count;
+		}
+
+		/*
+		 * Node ranges {ix0, ix1, iy0, iy1} the last `update()` recomputed.
+		 * Nodes freed by an obstacle that moved or went away lie in them.
+		 */
+		std::vector<std::array<int, 4>> const& dirty()const {
+			return m_dirty;
+		}
+
+		// Nodes {ix, iy} inside an obstacle before the last `update()` and in water after it
+		std::vector<std::array<int, 2>> const& freed()const {
+			return m_freed;
+		}
+
+		// Cached obstacle levelset at node (ix,iy), `band` outside of the grid
+		Real levelset(int ix, int iy)const {
+			if (ix < 0 || ix >= m_n || iy < 0 || iy >= m_n)
+				return m_band;
+			return m_levelset[iy + ix * m_n];
+		}
+
+		/*
+		 * Bilinear interpolation of the node cache and its exact gradient, the
+		 * same contract as `Environment::sample`.
+		 */
+		std::pair<Real, Vec2> sample(Vec2 pos)const {
+			Real gx = (pos[0] - m_xmin[0]) / m_dx - 0.5f;
+			Real gy = (pos[1] - m_xmin[1]) / m_dx - 0.5f;
+			int ix = (int)floor(gx);
+			int iy = (int)floor(gy);
+			Real wx = gx - ix;
+			Real wy = gy - iy;
+
+			Real f00 = levelset(ix, iy);
+			Real f01 = levelset(ix, iy + 1);
+			Real f10 = levelset(ix + 1, iy);
+			Real f11 = levelset(ix + 1, iy + 1);
+
+			Real d0 = f10 - f00;
+			Real d1 = f11 - f01;
+			Real value = (1 - wy) * (f00 + wx * d0) + wy * (f01 + wx * d1);
+			Vec2 grad = { ((1 - wy) * d0 + wy * d1) / m_dx, ((f01 - f00) + wx * (d1 - d0)) / m_dx };
+			return { value, grad };
+		}
+
+	private:
+		Vec2 nodePosition(int ix, int iy)const {
+			return Vec2{ m_xmin[0] + (ix + 0.5f) * m_dx, m_xmin[1] + (iy + 0.5f) * m_dx };
+		}
+
+		// Node index range [ix0,ix1)x[iy0,iy1) affected by `obstacle`
+		std::array<int, 4> footprint(Obstacle const& obstacle)const {
+			Real r = obstacle.boundingRadius() + m_band;
+			auto lo = [&](Real x, int dim) {
+				return std::clamp((int)floor((x - r - m_xmin[dim]) / m_dx - 0.5f), 0, m_n);
+			};
+			auto hi = [&](Real x, int dim) {
+				return std::clamp((int)ceil((x + r - m_xmin[dim]) / m_dx - 0.5f) + 1, 0, m_n);
+			};
+			return { lo(obstacle.position[0], 0), hi(obstacle.position[0], 0),
+					 lo(obstacle.position[1], 1), hi(obstacle.position[1], 1) };
+		}
+
+		struct Entry {
+			Obstacle current;
+			// state at the last `update()`
+			Obstacle last;
+			bool active;
+			bool drawn;
+		};
+
+		std::vector<Entry> m_entries;
+		// footprints cleared by `setOrigin()` and the ranges of the last `update()`
+		std::vector<std::array<int, 4>> m_pending, m_dirty;
+		std::vector<std::array<int, 2>> m_freed;
+		int m_active = 0;
+		int m_version = 0;
+
+		int m_n = 0;
+		Vec2 m_xmin = { 0, 0 };
+		Real m_dx = 1;
+		Real m_band = 0;
+		std::vector<Real> m_levelset;
+	};
+}
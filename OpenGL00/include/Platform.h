@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace WaterWavelets
+{
+	/*
+	 * Placement of the simulation's memory and threads.
+	 *
+	 * Set it before the grids and the default executor are created, later
+	 * changes only affect allocations and thread pools made afterwards.
+	 */
+	struct PlacementPolicy {
+		/** Ask the OS to back large allocations with transparent huge pages.
+		 * Only Linux does so, elsewhere the flag is ignored. */
+		bool huge_pages = false;
+		/** CPUs the worker threads of defaultExecutor() are pinned to, worker
+		 * i to worker_cpus[i % size]. Empty leaves them to the OS. */
+		std::vector<int> worker_cpus;
+	};
+
+	inline PlacementPolicy& placementPolicy() {
+		static PlacementPolicy policy;
+		return policy;
+	}
+
+	// Allocations of at least this size are aligned to it so they can use huge pages
+	constexpr std::size_t hugePageSize = std::size_t(2) << 20;
+	// Alignment of all other allocations, a cache line
+	constexpr std::size_t cacheLineSize = 64;
+
+	void* allocateAligned(std::size_t bytes);
+	void freeAligned(void* p, std::size_t bytes);
+
+	// Pins the calling thread to `cpu`, returns false if the OS refused
+	bool pinCurrentThread(int cpu);
+
+	/*
+	 * Allocator of cache line aligned storage, large blocks huge page aligned
+	 *
+	 * Elements are default-initialized, a `std::vector<float>` grown with it
+	 * leaves the new values uninitialized. Nothing touches the pages until
+	 * the owner writes them, so they are placed on the NUMA node of the
+	 * thread that writes first.
+	 */
+	template <class T>
+	class AlignedAllocator
+	{
+	public:
+		using value_type = T;
+
+		AlignedAllocator() = default;
+		template <class U>
+		AlignedAllocator(AlignedAllocator<U> const&) {}
+
+		T* allocate(std::size_t n) {
+			return static_cast<T*>(allocateAligned(n * sizeof(T)));
+		}
+		void deallocate(T* p, std::size_t n) {
+			freeAligned(p, n * sizeof(T));
+		}
+
+		template <class U>
+		void construct(U* p) {
+			::new (static_cast<void*>(p)) U;
+		}
+		template <class U, class... Args>
+		void construct(U* p, Args&&... args) {
+			::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+		}
+
+		template <class U>
+		struct rebind {
+			using other = AlignedAllocator<U>;
+		};
+
+		bool operator==(AlignedAllocator const&)const {
+			return true;
+		}
+		bool operator!=(AlignedAllocator const&)const {
+			return false;
+		}
+	};
+}
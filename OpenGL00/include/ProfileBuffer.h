@@ -1,7 +1,9 @@
 #pragma once
+#include <algorithm>
 #include <array>
 #include <vector>
 #include "../include/Math.h"
+#include "Executor.h"
 
 namespace WaterWavelets 
 {
@@ -21,19 +23,42 @@ namespace WaterWavelets
 		resolution: ֱʵĽڵ
 		periodicity: պȷΪ periodicity * pow(2,zeta_max)
 		integration_nodes: ֽڵ
+		executor: runs the integrations of the resolution nodes
 		*/
 		template<typename Spectrum>
 		void precompute(Spectrum& spectrum,float time,float zeta_min,
 			float zeta_max,int resolution = 4096,int periodicity = 2,
-			int integration_nodes = 100) 
+			int integration_nodes = 100, Executor& executor = defaultExecutor()) 
+		{
+			resize(resolution, zeta_max, periodicity);
+			// blocks of nodes keep the per item overhead of the executor small
+			constexpr int block = 64;
+			executor.parallelFor((resolution + block - 1) / block, [&](int b) {
+				precomputeNodes(spectrum, time, zeta_min, zeta_max, b * block,
+					std::min(resolution, (b + 1) * block), integration_nodes);
+			});
+		}
+		/*
+		Sets the resolution and period for precomputeNodes(), arguments as above
+		*/
+		void resize(int resolution, float zeta_max, int periodicity = 2)
 		{
 			m_data.resize(resolution);//ɢ㾫ȣĬ4096
 			m_period = periodicity * pow(2, zeta_max);//periodicityƵʣˮ
+		}
+		/*
+		Computes the nodes [begin, end) of a buffer set up by resize(), the
+		other arguments as for precompute()
+		*/
+		template<typename Spectrum>
+		void precomputeNodes(Spectrum& spectrum, float time, float zeta_min,
+			float zeta_max, int begin, int end, int integration_nodes = 100)
+		{
+			const int resolution = m_data.size();
 			/*
 			ÿ㣬мõ
 			*/
-#pragma omp parallel for
-			for (int i = 0; i < resolution; ++i)
+			for (int i = begin; i < end; ++i)
 			{
 				// 2*pi
 				constexpr float tau = 6.28318530718;
@@ -0,0 +1,503 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Checkpoint.h"
+#include "WaveGrid.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Frame stream shared by `FrameRecorder` and `FramePlayer`.
+	 *
+	 * A recording is a header {magic, version, n_x, n_theta, n_zeta,
+	 * keyframe interval} followed by frames. Every frame starts with its byte
+	 * size, a keyframe flag, the time and the window origin of the grid.
+	 *
+	 * Amplitudes are quantised per (theta, zeta) plane with the step
+	 * max|A| / 32767 taken at the last keyframe, but at least 1/256 of the
+	 * step of the loudest plane. Keyframes store the 16 bit values, the other
+	 * frames the difference to the previous reconstructed frame in units of
+	 * the step as zigzag varints, zero runs as a zero followed by the run
+	 * length. Since the encoder differences against what
+	 * the decoder reconstructs, the error stays below half a step and does
+	 * not accumulate between keyframes.
+	 */
+	namespace FrameCodec
+	{
+		constexpr std::uint32_t magic = 0x43525757; // "WWRC"
+		constexpr std::uint32_t version = 1;
+
+		inline void putVarint(std::vector<std::uint8_t>& out, std::uint32_t v) {
+			while (v >= 0x80) {
+				out.push_back(std::uint8_t(v | 0x80));
+				v >>= 7;
+			}
+			out.push_back(std::uint8_t(v));
+		}
+		inline bool getVarint(std::uint8_t const*& p, std::uint8_t const* end, std::uint32_t& v) {
+			v = 0;
+			for (int shift = 0; p != end && shift < 35; shift += 7) {
+				std::uint8_t byte = *p++;
+				v |= std::uint32_t(byte & 0x7f) << shift;
+				if (!(byte & 0x80))
+					return true;
+			}
+			return false;
+		}
+		inline std::uint32_t zigzag(std::int32_t v) {
+			return (std::uint32_t(v) << 1) ^ std::uint32_t(v >> 31);
+		}
+		inline std::int32_t unzigzag(std::uint32_t v) {
+			return std::int32_t(v >> 1) ^ -std::int32_t(v & 1);
+		}
+	}
+
+	/*
+	 * Streams the amplitudes of a `WaveGrid` to disk.
+	 *
+	 * `record()` only copies the amplitudes into a recycled buffer and hands
+	 * it to a writer thread, which does the encoding and all file I/O. If the
+	 * writer falls `maxPending` frames behind, frames are dropped instead of
+	 * stalling the simulation. Only the grid itself is recorded, not its
+	 * nested grids. A failed write ends the recording, later frames are
+	 * dropped.
+	 */
+	class FrameRecorder
+	{
+	public:
+		~FrameRecorder() {
+			close();
+		}
+
+		/*
+		 * Starts a recording of grids shaped like `grid`, every
+		 * `keyframeInterval`-th written frame is a keyframe.
+		 */
+		bool open(std::string const& path, WaveGrid const& grid, int keyframeInterval = 30, int maxPending = 4) {
+			close();
+			m_file.open(path, std::ios::binary);
+			if (!m_file) {
+				std::cout << "ERROR::RECORDING::FILE_NOT_WRITABLE: " << path << std::endl;
+				return false;
+			}
+			for (int dim = 0; dim < 4; dim++)
+				m_dims[dim] = grid.gridDim(dim);
+			m_keyframeInterval = std::max(1, keyframeInterval);
+			m_maxPending = std::max(1, maxPending);
+			m_written = 0;
+			m_dropped = 0;
+			m_failed = false;
+			m_stop = false;
+
+			CheckpointWriter out(m_file);
+			out.put(FrameCodec::magic);
+			out.put(FrameCodec::version);
+			out.put<std::int32_t>(m_dims[WaveGrid::X]);
+			out.put<std::int32_t>(m_dims[WaveGrid::Theta]);
+			out.put<std::int32_t>(m_dims[WaveGrid::Zeta]);
+			out.put<std::int32_t>(m_keyframeInterval);
+			m_file.flush();
+			if (!m_file.good()) {
+				std::cout << "ERROR::RECORDING::WRITE_FAILED: " << path << std::endl;
+				m_file.close();
+				return false;
+			}
+
+			m_writer = std::thread([this] { writerLoop(); });
+			return true;
+		}
+
+		/*
+		 * Queues the current amplitudes of `grid`, never waits for the disk.
+		 * Returns false if the frame was dropped, which includes a grid whose
+		 * resolution changed since `open()`.
+		 */
+		bool record(WaveGrid const& grid) {
+			bool shaped = true;
+			for (int dim = 0; dim < 4; dim++)
+				shaped = shaped && grid.gridDim(dim) == m_dims[dim];
+			std::vector<Real> buffer;
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				if (!shaped || !m_writer.joinable() || m_failed || (int)m_pending.size() >= m_maxPending) {
+					m_dropped++;
+					return false;
+				}
+				if (!m_free.empty()) {
+					buffer = std::move(m_free.back());
+					m_free.pop_back();
+				}
+			}
+
+			const int n = m_dims[WaveGrid::X], nplane = m_dims[WaveGrid::Theta] * m_dims[WaveGrid::Zeta];
+			buffer.resize(n * n * nplane);
+			grid.executor().parallelFor(n, [&](int ix) {
+				for (int iy = 0; iy < n; iy++) {
+					Real* node = &buffer[nplane * (iy + n * ix)];
+					for (int itheta = 0; itheta < m_dims[WaveGrid::Theta]; itheta++)
+						for (int izeta = 0; izeta < m_dims[WaveGrid::Zeta]; izeta++)
+							node[izeta + m_dims[WaveGrid::Zeta] * itheta] = grid.m_amplitude(ix, iy, itheta, izeta);
+				}
+			});
+
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_pending.push_back(Frame{ grid.m_time, Vec2{ grid.m_xmin[WaveGrid::X], grid.m_xmin[WaveGrid::Y] }, std::move(buffer) });
+			}
+			m_wakeup.notify_one();
+			return true;
+		}
+
+		// Writes the queued frames and closes the file
+		void close() {
+			if (!m_writer.joinable())
+				return;
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_stop = true;
+			}
+			m_wakeup.notify_one();
+			m_writer.join();
+			m_file.close();
+
+			// left over by a failed write
+			for (Frame& frame : m_pending)
+				m_free.push_back(std::move(frame.amplitude));
+			m_pending.clear();
+		}
+
+		int written()const {
+			return m_written;
+		}
+		int dropped()const {
+			return m_dropped;
+		}
+		// Did a write fail, which ends the recording
+		bool failed()const {
+			return m_failed;
+		}
+
+	private:
+		struct Frame {
+			Real time;
+			Vec2 origin;
+			std::vector<Real> amplitude;
+		};
+
+		void writerLoop() {
+			while (true) {
+				Frame frame;
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_wakeup.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+					if (m_pending.empty())
+						return;
+					frame = std::move(m_pending.front());
+					m_pending.pop_front();
+				}
+
+				bool keyframe = m_written % m_keyframeInterval == 0;
+				encode(frame.amplitude, keyframe);
+
+				CheckpointWriter out(m_file);
+				out.put<std::uint32_t>(sizeof(std::uint8_t) + sizeof(Real) + sizeof(Vec2) + m_payload.size());
+				out.put<std::uint8_t>(keyframe);
+				out.put(frame.time);
+				out.put(frame.origin);
+				m_file.write(reinterpret_cast<char const*>(m_payload.data()), m_payload.size());
+				// flushed so a full disk shows up at this frame
+				m_file.flush();
+				if (!m_file.good()) {
+					std::cout << "ERROR::RECORDING::WRITE_FAILED: frame " << m_written << std::endl;
+					m_failed = true;
+					return;
+				}
+				m_written++;
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_free.push_back(std::move(frame.amplitude));
+			}
+		}
+
+		// Encodes `amplitude` into `m_payload` and updates the reconstruction
+		void encode(std::vector<Real> const& amplitude, bool keyframe) {
+			const int nplane = m_dims[WaveGrid::Theta] * m_dims[WaveGrid::Zeta];
+			const int count = amplitude.size();
+			m_payload.clear();
+
+			if (keyframe) {
+				// planes quiet at the keyframe may fill up later, their step is
+				// kept within 1/256 of the loudest plane's
+				m_step.assign(nplane, 0);
+				for (int i = 0; i < count; i++)
+					m_step[i % nplane] = std::max(m_step[i % nplane], std::abs(amplitude[i]));
+				Real loudest = *std::max_element(m_step.begin(), m_step.end());
+				if (loudest == 0)
+					loudest = 1;
+				for (Real& step : m_step)
+					step = std::max(step, loudest / 256) / 32767;
+
+				m_payload.resize(nplane * sizeof(Real) + count * sizeof(std::int16_t));
+				std::memcpy(m_payload.data(), m_step.data(), nplane * sizeof(Real));
+				auto q = reinterpret_cast<std::int16_t*>(m_payload.data() + nplane * sizeof(Real));
+				m_recon.resize(count);
+				for (int i = 0; i < count; i++) {
+					q[i] = (std::int16_t)std::lround(amplitude[i] / m_step[i % nplane]);
+					m_recon[i] = q[i] * m_step[i % nplane];
+				}
+				return;
+			}
+
+			int zeros = 0;
+			for (int i = 0; i < count; i++) {
+				Real step = m_step[i % nplane];
+				std::int32_t d = (std::int32_t)std::lround((amplitude[i] - m_recon[i]) / step);
+				m_recon[i] += d * step;
+				if (d == 0) {
+					zeros++;
+					continue;
+				}
+				if (zeros) {
+					FrameCodec::putVarint(m_payload, 0);
+					FrameCodec::putVarint(m_payload, zeros);
+					zeros = 0;
+				}
+				FrameCodec::putVarint(m_payload, FrameCodec::zigzag(d));
+			}
+			if (zeros) {
+				FrameCodec::putVarint(m_payload, 0);
+				FrameCodec::putVarint(m_payload, zeros);
+			}
+		}
+
+		std::ofstream m_file;
+		std::thread m_writer;
+		std::array<int, 4> m_dims = { 0, 0, 0, 0 };
+		int m_keyframeInterval = 30;
+		int m_maxPending = 4;
+
+		// frames handed over to the writer and buffers handed back
+		std::mutex m_mutex;
+		std::condition_variable m_wakeup;
+		std::deque<Frame> m_pending;
+		std::vector<std::vector<Real>> m_free;
+		bool m_stop = false;
+		std::atomic<int> m_dropped = 0;
+		std::atomic<bool> m_failed = false;
+
+		// writer thread only
+		std::atomic<int> m_written = 0;
+		std::vector<Real> m_step;
+		std::vector<Real> m_recon;
+		std::vector<std::uint8_t> m_payload;
+	};
+
+	/*
+	 * Plays back a recording of `FrameRecorder`.
+	 *
+	 * Frame offsets are indexed on `open()`, `seek()` decodes from the
+	 * closest keyframe before the requested frame. `apply()` puts the current
+	 * frame into a grid of the same shape, so it renders the recorded sea
+	 * without running the solver.
+	 */
+	class FramePlayer
+	{
+	public:
+		bool open(std::string const& path) {
+			m_file.close();
+			m_file.clear();
+			m_file.open(path, std::ios::binary);
+			m_frames.clear();
+			m_current = -1;
+
+			CheckpointReader in(m_file);
+			if (in.get<std::uint32_t>() != FrameCodec::magic || in.get<std::uint32_t>() != FrameCodec::version) {
+				std::cout << "ERROR::RECORDING::NOT_A_RECORDING: " << path << std::endl;
+				return false;
+			}
+			m_n = in.get<std::int32_t>();
+			m_ntheta = in.get<std::int32_t>();
+			m_nzeta = in.get<std::int32_t>();
+			in.get<std::int32_t>();
+			if (!in.ok() || m_n <= 0 || m_ntheta <= 0 || m_nzeta <= 0) {
+				std::cout << "ERROR::RECORDING::BAD_HEADER: " << path << std::endl;
+				return false;
+			}
+
+			// index the frames, a truncated last frame is ignored
+			std::streamoff offset = m_file.tellg();
+			m_file.seekg(0, std::ios::end);
+			const std::streamoff end = m_file.tellg();
+			while (true) {
+				m_file.seekg(offset);
+				std::uint32_t size = in.get<std::uint32_t>();
+				bool keyframe = in.get<std::uint8_t>();
+				Real time = in.get<Real>();
+				std::streamoff next = offset + std::streamoff(sizeof(std::uint32_t)) + size;
+				if (!in.ok() || next > end || (m_frames.empty() && !keyframe))
+					break;
+				m_frames.push_back(Entry{ offset, time, keyframe });
+				offset = next;
+			}
+			if (m_frames.empty())
+				std::cout << "ERROR::RECORDING::NO_FRAMES: " << path << std::endl;
+			return !m_frames.empty();
+		}
+
+		int frameCount()const {
+			return m_frames.size();
+		}
+		Real frameTime(int frame)const {
+			return m_frames[frame].time;
+		}
+		int currentFrame()const {
+			return m_current;
+		}
+
+		// Decodes `frame`, returns false if it is corrupt
+		bool seek(int frame) {
+			if (frame < 0 || frame >= frameCount())
+				return false;
+			int first = frame;
+			if (frame != m_current + 1 || m_current < 0)
+				while (!m_frames[first].keyframe)
+					first--;
+			for (int i = first; i <= frame; i++) {
+				if (!decode(i)) {
+					m_current = -1;
+					return false;
+				}
+				m_current = i;
+			}
+			return true;
+		}
+
+		// Advances to the next frame, false at the end of the recording
+		bool next() {
+			return seek(m_current + 1);
+		}
+
+		/*
+		 * Decoded amplitudes of the current frame, node after node with
+		 * theta x zeta values each like `Grid`, and its window origin
+		 */
+		std::vector<Real> const& amplitude()const {
+			return m_amplitude;
+		}
+		Vec2 origin()const {
+			return m_origin;
+		}
+
+		/*
+		 * Moves the window of `grid` to the recorded one and sets its
+		 * amplitudes and time to the current frame. The grid has to have the
+		 * recorded resolution, its sparse tiles are refreshed.
+		 */
+		bool apply(WaveGrid& grid)const {
+			if (m_current < 0 || grid.gridDim(WaveGrid::X) != m_n ||
+				grid.gridDim(WaveGrid::Theta) != m_ntheta || grid.gridDim(WaveGrid::Zeta) != m_nzeta) {
+				std::cout << "ERROR::RECORDING::GRID_MISMATCH" << std::endl;
+				return false;
+			}
+			Vec2 half = { 0.5f * (grid.m_xmax[WaveGrid::X] - grid.m_xmin[WaveGrid::X]),
+						  0.5f * (grid.m_xmax[WaveGrid::Y] - grid.m_xmin[WaveGrid::Y]) };
+			grid.recenter(m_origin + half);
+
+			const int nplane = m_ntheta * m_nzeta;
+			grid.executor().parallelFor(m_n, [&](int ix) {
+				for (int iy = 0; iy < m_n; iy++) {
+					Real const* node = &m_amplitude[nplane * (iy + m_n * ix)];
+					for (int itheta = 0; itheta < m_ntheta; itheta++)
+						for (int izeta = 0; izeta < m_nzeta; izeta++)
+							grid.m_amplitude(ix, iy, itheta, izeta) = node[izeta + m_nzeta * itheta];
+				}
+			});
+			grid.touchTiles(grid.wholeGrid());
+			grid.m_time = m_frames[m_current].time;
+			grid.precomputeProfileBuffers();
+			return true;
+		}
+
+	private:
+		struct Entry {
+			std::streamoff offset;
+			Real time;
+			bool keyframe;
+		};
+
+		bool decode(int frame) {
+			m_file.clear();
+			m_file.seekg(m_frames[frame].offset);
+			CheckpointReader in(m_file);
+			std::uint32_t size = in.get<std::uint32_t>();
+			bool keyframe = in.get<std::uint8_t>();
+			in.get<Real>();
+			m_origin = in.get<Vec2>();
+			std::uint32_t header = sizeof(std::uint8_t) + sizeof(Real) + sizeof(Vec2);
+			if (!in.ok() || size < header)
+				return false;
+			m_payload.resize(size - header);
+			m_file.read(reinterpret_cast<char*>(m_payload.data()), m_payload.size());
+			if (!m_file)
+				return false;
+
+			const int nplane = m_ntheta * m_nzeta;
+			const int count = m_n * m_n * nplane;
+			if (keyframe) {
+				if (m_payload.size() != nplane * sizeof(Real) + count * sizeof(std::int16_t))
+					return false;
+				m_step.resize(nplane);
+				std::memcpy(m_step.data(), m_payload.data(), nplane * sizeof(Real));
+				std::vector<std::int16_t> q(count);
+				std::memcpy(q.data(), m_payload.data() + nplane * sizeof(Real), count * sizeof(std::int16_t));
+				m_amplitude.resize(count);
+				for (int i = 0; i < count; i++)
+					m_amplitude[i] = q[i] * m_step[i % nplane];
+				return true;
+			}
+
+			if ((int)m_amplitude.size() != count)
+				return false;
+			std::uint8_t const* p = m_payload.data();
+			std::uint8_t const* end = p + m_payload.size();
+			int i = 0;
+			while (p != end) {
+				std::uint32_t v;
+				if (!FrameCodec::getVarint(p, end, v))
+					return false;
+				if (v == 0) {
+					if (!FrameCodec::getVarint(p, end, v) || v > std::uint32_t(count - i))
+						return false;
+					i += v;
+					continue;
+				}
+				if (i >= count)
+					return false;
+				m_amplitude[i] += FrameCodec::unzigzag(v) * m_step[i % nplane];
+				i++;
+			}
+			return i == count;
+		}
+
+		std::ifstream m_file;
+		std::vector<Entry> m_frames;
+		int m_current = -1;
+		int m_n = 0, m_ntheta = 0, m_nzeta = 0;
+
+		std::vector<Real> m_step;
+		std::vector<Real> m_amplitude;
+		Vec2 m_origin = { 0, 0 };
+		std::vector<std::uint8_t> m_payload;
+	};
+}
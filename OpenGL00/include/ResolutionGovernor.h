@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+#include "WaveGrid.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Keeps the wall-clock cost of WaveGrid::timeStep() within a budget by
+	 * changing the resolution of the grid, see WaveGrid::resize().
+	 *
+	 * Step times are smoothed exponentially. Once the smoothed cost leaves
+	 * the band [low, high] * budget the grid is resized so that its predicted
+	 * cost is target * budget. The cost is modelled as a fixed part, e.g. the
+	 * profile buffers, plus a part proportional to the nodes n_x^2 * n_theta,
+	 * fitted to the smoothed costs of the last two resolutions; with only
+	 * one known resolution all of it is taken as proportional. The band is
+	 * the hysteresis: a resize lands well inside it, so measurement noise does
+	 * not flip the grid between two resolutions. After a resize the governor
+	 * waits `cooldown` steps, the first ones pay for cold caches, and then
+	 * starts measuring afresh.
+	 */
+	class ResolutionGovernor
+	{
+	public:
+		struct Settings {
+			/** Wall-clock time a step may take [ms]. */
+			double budget_ms = 8;
+			/** Band of the smoothed cost, in budgets, that is left alone. */
+			double low = 0.6;
+			double high = 1.0;
+			/** Cost a resize aims for, in budgets, inside the band. */
+			double target = 0.8;
+			/** Weight of the newest step time in the smoothed cost. */
+			double smoothing = 0.2;
+			/** Steps after a resize that are not measured. */
+			int cooldown = 5;
+			/** Steps measured before the first decision. */
+			int warmup = 5;
+			/** Factor by which one resize may change the node count at most. */
+			double max_change = 2;
+
+			/** Which dimensions to scale and their ranges. With both, n_x takes
+			 * two thirds of the change and n_theta one third. */
+			bool scale_n_x = true;
+			int min_n_x = 32;
+			int max_n_x = 512;
+			bool scale_n_theta = false;
+			int min_n_theta = 8;
+			int max_n_theta = 32;
+		};
+
+		ResolutionGovernor(WaveGrid& grid, Settings s)
+			: m_grid(grid), m_settings(s) {}
+
+		/*
+		Measured WaveGrid::timeStep(), followed by a resize if needed
+		dt, fullUpdate as for WaveGrid::timeStep(), note that the CFL step
+		grid().cflTimeStep() changes with n_x
+		*/
+		void timeStep(Real dt, bool fullUpdate = true) {
+			auto start = std::chrono::steady_clock::now();
+			m_grid.timeStep(dt, fullUpdate);
+			observe(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		// For callers measuring the steps themselves, `ms` is the time of one step
+		void observe(double ms) {
+			if (m_skip > 0) {
+				m_skip--;
+				return;
+			}
+			m_cost = m_measured == 0 ? ms : (1 - m_settings.smoothing) * m_cost + m_settings.smoothing * ms;
+			if (++m_measured < m_settings.warmup)
+				return;
+
+			const double budget = m_settings.budget_ms;
+			if (m_cost > m_settings.high * budget || m_cost < m_settings.low * budget)
+				adjust(predictedFactor(m_settings.target * budget));
+		}
+
+		// Smoothed cost of a step [ms], 0 before the first measurement
+		double cost()const {
+			return m_measured > 0 ? m_cost : 0;
+		}
+		int resizes()const {
+			return m_resizes;
+		}
+		WaveGrid& grid() {
+			return m_grid;
+		}
+
+	private:
+		double nodes()const {
+			return double(m_grid.gridDim(WaveGrid::X)) * m_grid.gridDim(WaveGrid::X) * m_grid.gridDim(WaveGrid::Theta);
+		}
+
+		// Factor of the node count expected to bring the cost to `cost`
+		double predictedFactor(double cost) {
+			const double N = nodes();
+			if (m_samples[1].first != N)
+				m_samples[0] = m_samples[1];
+			m_samples[1] = { N, m_cost };
+
+			auto [N0, c0] = m_samples[0];
+			if (N0 > 0 && N0 != N) {
+				double perNode = (m_cost - c0) / (N - N0);
+				double fixed = m_cost - perNode * N;
+				if (perNode > 0)
+					return std::max(cost - fixed, 0.0) / perNode / N;
+			}
+			return cost / m_cost;
+		}
+
+		// Scales the node count by about `factor`
+		void adjust(double factor) {
+			factor = std::clamp(factor, 1 / m_settings.max_change, m_settings.max_change);
+
+			double xFactor = 1, thetaFactor = 1;
+			if (m_settings.scale_n_x && m_settings.scale_n_theta) {
+				xFactor = std::cbrt(factor);
+				thetaFactor = std::cbrt(factor);
+			}
+			else if (m_settings.scale_n_x) {
+				xFactor = std::sqrt(factor);
+			}
+			else if (m_settings.scale_n_theta) {
+				thetaFactor = factor;
+			}
+
+			const int n_x = m_grid.gridDim(WaveGrid::X);
+			const int n_theta = m_grid.gridDim(WaveGrid::Theta);
+			int new_n_x = std::clamp((int)std::lround(n_x * xFactor), m_settings.min_n_x, m_settings.max_n_x);
+			// multiples of four keep the directions of the axes and diagonals
+			int new_n_theta = 4 * std::clamp((int)std::lround(n_theta * thetaFactor / 4),
+				(m_settings.min_n_theta + 3) / 4, m_settings.max_n_theta / 4);
+			if (!m_settings.scale_n_x)
+				new_n_x = n_x;
+			if (!m_settings.scale_n_theta)
+				new_n_theta = n_theta;
+
+			if (new_n_x != n_x || new_n_theta != n_theta) {
+				m_grid.resize(new_n_x, new_n_theta);
+				m_resizes++;
+			}
+			// measure afresh, also when clamped, so a grid at its limit is not retried every step
+			m_skip = m_settings.cooldown;
+			m_measured = 0;
+		}
+
+		WaveGrid& m_grid;
+		Settings m_settings;
+
+		double m_cost = 0;
+		// {nodes, smoothed cost} of the last two resolutions
+		std::pair<double, double> m_samples[2] = {};
+		int m_measured = 0;
+		int m_skip = 0;
+		int m_resizes = 0;
+	};
+}
@@ -1,88 +1,317 @@
 #pragma once
 
-#include <functional>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "Platform.h"
+
+/*
+ * Simulation thread running `Simulation::update()` at a fixed rate.
+ *
+ * Every tick of length `interval` runs all per-loop tasks
+ * `ticks_per_interval` times, `update()` being the first of them. Between
+ * ticks the thread sleeps. Tasks submitted from other threads go through a
+ * lock-free ring and run at the latest before the next tick; a sleeping loop
+ * is woken for them. A paused loop sleeps until it gets a task or is
+ * resumed.
+ */
 template <typename Simulation> class SimulationLoop {
 public:
-    ~SimulationLoop() {
-        keep_running = false;
-        main_loop_thread.join();
+    using Clock = std::chrono::steady_clock;
+
+    /*
+     * interval  wall-clock length of a tick, zero runs ticks back to back
+     * ticks_per_interval  simulation updates per tick
+     * capacity  size of the task ring, rounded up to a power of two
+     */
+    explicit SimulationLoop(Clock::duration interval = std::chrono::microseconds(16667),
+                            int ticks_per_interval = 1, std::size_t capacity = 1024)
+        : ring(capacity) {
+        setRate(interval, ticks_per_interval);
     }
 
-    using Task = std::function<void(Simulation&)>;
+    ~SimulationLoop() { stop(); }
+
+    /*
+     * Move-only `void(Simulation&)` callable. Callables of up to `inline_size`
+     * bytes are stored in place, larger ones on the heap.
+     */
+    class Task {
+    public:
+        static constexpr std::size_t inline_size = 48;
+
+        Task() = default;
+
+        template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+        Task(F&& f) {
+            using Fn = std::decay_t<F>;
+            if constexpr (sizeof(Fn) <= inline_size && alignof(Fn) <= alignof(std::max_align_t) &&
+                          std::is_nothrow_move_constructible_v<Fn>) {
+                new (&storage) Fn(std::forward<F>(f));
+                ops = &inlineOps<Fn>;
+            }
+            else {
+                new (&storage) Fn*(new Fn(std::forward<F>(f)));
+                ops = &heapOps<Fn>;
+            }
+        }
+
+        Task(Task&& other) noexcept { moveFrom(other); }
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~Task() { reset(); }
+
+        void operator()(Simulation& sim) { ops->invoke(&storage, sim); }
+
+        explicit operator bool() const { return ops != nullptr; }
+
+    private:
+        struct Ops {
+            void (*invoke)(void*, Simulation&);
+            void (*move)(void*, void*);
+            void (*destroy)(void*);
+        };
+
+        template <class Fn> static constexpr Ops inlineOps = {
+            [](void* p, Simulation& sim) { (*static_cast<Fn*>(p))(sim); },
+            [](void* from, void* to) {
+                new (to) Fn(std::move(*static_cast<Fn*>(from)));
+                static_cast<Fn*>(from)->~Fn();
+            },
+            [](void* p) { static_cast<Fn*>(p)->~Fn(); },
+        };
+
+        template <class Fn> static constexpr Ops heapOps = {
+            [](void* p, Simulation& sim) { (**static_cast<Fn**>(p))(sim); },
+            [](void* from, void* to) { new (to) Fn*(*static_cast<Fn**>(from)); },
+            [](void* p) { delete *static_cast<Fn**>(p); },
+        };
+
+        void moveFrom(Task& other) {
+            ops = other.ops;
+            if (ops)
+                ops->move(&other.storage, &storage);
+            other.ops = nullptr;
+        }
+
+        void reset() {
+            if (ops)
+                ops->destroy(&storage);
+            ops = nullptr;
+        }
+
+        std::aligned_storage_t<inline_size, alignof(std::max_align_t)> storage;
+        Ops const* ops = nullptr;
+    };
 
     void start(Simulation& sim) {
 
         addTaskPerLoop([](Simulation& s) { s.update(); });
 
         // start the main thread
-        main_loop_thread = std::thread([&sim, this]() {
+        main_loop_thread = std::thread([&sim, this]() { run(sim); });
+    }
 
-            while (keep_running) {
+    // Stops and joins the simulation thread, queued tasks are discarded
+    void stop() {
+        keep_running.store(false);
+        wake();
+        if (main_loop_thread.joinable())
+            main_loop_thread.join();
+    }
 
-                std::queue<Task> tasks;
+    void pause(bool paused) {
+        this->paused.store(paused);
+        wake();
+    }
 
-                // Tasks per loop
-                tasks = tasks_per_loop.getCopy();
-                while (!tasks.empty()) {
-                    auto& task = tasks.front();
-                    task(sim);
-                    tasks.pop();
-                }
+    void setRate(Clock::duration interval, int ticks_per_interval) {
+        this->interval.store(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count());
+        this->ticks_per_interval.store(ticks_per_interval < 1 ? 1 : ticks_per_interval);
+        wake();
+    }
 
-                // Tasks to evaluate
-                tasks = tasks_queue.getCopy();
-                tasks_queue.clear();
-                while (!tasks.empty()) {
-                    auto& task = tasks.front();
-                    task(sim);
-                    tasks.pop();
-                }
-            }
-            });
+    // Pins the simulation thread to `cpu`, before or after start()
+    void setAffinity(int cpu) {
+        addTask([cpu](Simulation&) { WaterWavelets::pinCurrentThread(cpu); });
     }
 
-    void addTaskPerLoop(Task const& task) { tasks_per_loop.push(task); }
+    template <class F> void addTaskPerLoop(F&& task) { submit(std::forward<F>(task), true); }
 
-    void addTask(Task const& task) { tasks_queue.push(task); }
+    template <class F> void addTask(F&& task) { submit(std::forward<F>(task), false); }
 
 private:
-    template <class T> class synch_queue {
-    public:
-        std::queue<T> getCopy() {
-            std::lock_guard<std::mutex> guard(_mutex);
-            return _queue;
+    void run(Simulation& sim) {
+        auto next = Clock::now();
+        while (keep_running.load()) {
+            runTasks(sim);
+
+            if (paused.load()) {
+                sleepUntil(Clock::time_point::max());
+                next = Clock::now();
+                continue;
+            }
+
+            auto now = Clock::now();
+            if (now < next) {
+                sleepUntil(next);
+                continue;
+            }
+
+            const int ticks = ticks_per_interval.load();
+            for (int i = 0; i < ticks; i++)
+                for (auto& task : tasks_per_loop)
+                    task(sim);
+
+            // a loop falling behind drops ticks instead of catching up in a burst
+            next += std::chrono::nanoseconds(interval.load());
+            if (next < now)
+                next = now;
+        }
+    }
+
+    void runTasks(Simulation& sim) {
+        Entry entry;
+        while (ring.pop(entry)) {
+            if (entry.per_loop)
+                tasks_per_loop.push_back(std::move(entry.task));
+            else
+                entry.task(sim);
+        }
+    }
+
+    template <class F> void submit(F&& task, bool per_loop) {
+        Entry entry{ Task(std::forward<F>(task)), per_loop };
+        // only waits if the loop is `capacity` tasks behind
+        while (!ring.push(entry))
+            std::this_thread::yield();
+        // pairs with the store of `sleeping` in sleepUntil()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load())
+            wake();
+    }
+
+    void sleepUntil(Clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto awake = [this] { return !keep_running.load() || !ring.empty() || woken; };
+        if (deadline == Clock::time_point::max())
+            wakeup.wait(lock, awake);
+        else
+            wakeup.wait_until(lock, deadline, awake);
+        woken = false;
+        sleeping.store(false);
+    }
+
+    void wake() {
+        {
+            std::lock_guard<std::mutex> guard(sleep_mutex);
+            woken = true;
         }
+        wakeup.notify_one();
+    }
+
+    struct Entry {
+        Task task;
+        bool per_loop = false;
+    };
 
-        void push(T const& t) {
-            std::lock_guard<std::mutex> guard(_mutex);
-            _queue.push(t);
+    /*
+     * Bounded multi-producer single-consumer ring. Each cell carries a
+     * sequence number telling producers and the consumer whose turn it is,
+     * producers claim cells with a CAS on `head`.
+     */
+    class Ring {
+    public:
+        explicit Ring(std::size_t capacity) {
+            std::size_t size = 2;
+            while (size < capacity)
+                size *= 2;
+            cells = std::vector<Cell>(size);
+            mask = size - 1;
+            for (std::size_t i = 0; i < size; i++)
+                cells[i].sequence.store(i, std::memory_order_relaxed);
         }
 
-        void push(T&& t) {
-            std::lock_guard<std::mutex> guard(_mutex);
-            _queue.push(std::forward<T>(t));
+        bool push(Entry& entry) {
+            std::size_t pos = head.load(std::memory_order_relaxed);
+            while (true) {
+                Cell& cell = cells[pos & mask];
+                std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+                if (diff == 0) {
+                    if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.entry = std::move(entry);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false;
+                }
+                else {
+                    pos = head.load(std::memory_order_relaxed);
+                }
+            }
         }
 
-        void clear() {
-            std::lock_guard<std::mutex> guard(_mutex);
-            while (!_queue.empty())
-                _queue.pop();
+        // consumer thread only
+        bool pop(Entry& entry) {
+            Cell& cell = cells[tail & mask];
+            if (cell.sequence.load(std::memory_order_acquire) != tail + 1)
+                return false;
+            entry = std::move(cell.entry);
+            cell.entry.task = Task();
+            cell.sequence.store(tail + mask + 1, std::memory_order_release);
+            tail++;
+            return true;
         }
 
+        bool empty() const { return cells[tail & mask].sequence.load(std::memory_order_acquire) != tail + 1; }
+
     private:
-        std::mutex    _mutex;
-        std::queue<T> _queue;
+        struct Cell {
+            std::atomic<std::size_t> sequence{ 0 };
+            Entry entry;
+        };
+
+        std::vector<Cell> cells;
+        std::size_t mask = 0;
+        alignas(64) std::atomic<std::size_t> head{ 0 };
+        alignas(64) std::size_t tail = 0;
     };
 
 private:
-    std::thread       main_loop_thread;
-    synch_queue<Task> tasks_queue;
-    synch_queue<Task> tasks_per_loop;
+    std::thread main_loop_thread;
+    Ring ring;
+    // simulation thread only
+    std::vector<Task> tasks_per_loop;
+
+    std::atomic<bool> keep_running{ true };
+    std::atomic<bool> paused{ false };
+    std::atomic<long long> interval{ 0 };
+    std::atomic<int> ticks_per_interval{ 1 };
 
-    bool keep_running = true;
+    // sleeping simulation thread and its wakeup
+    std::mutex sleep_mutex;
+    std::condition_variable wakeup;
+    std::atomic<bool> sleeping{ false };
+    bool woken = false;
 };
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Executor.h"
+#include "WaveGrid.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Steps many `WaveGrid`s at their own rates on one pool of threads.
+	 *
+	 * Every registered grid is stepped once per `interval` and each step is
+	 * due before the next one is, which is its deadline. A step runs on a
+	 * pool thread with the grid's executor pointed at the pool, so the tile
+	 * tasks of all grids stepped at the same time share the threads. Free
+	 * threads take the next tile of the most urgent grid, the one with the
+	 * highest priority and among those the earliest deadline, and start due
+	 * steps in the same order once no tile is left. A grid falling behind
+	 * drops steps like `SimulationLoop` does.
+	 *
+	 * Time the pool threads spend on the tiles and the rest of the step of a
+	 * grid is counted as its CPU time, see stats().
+	 *
+	 * All parallel loops of a step go through the grid's executor, none
+	 * opens an OpenMP team of its own, so the pool is the only set of
+	 * threads. Task graphs of pipelined steps hand their threads back as
+	 * soon as nothing of theirs is ready, see `TaskGraph`.
+	 */
+	class SimulationScheduler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		struct Options {
+			/** Simulated time of a step, 0 takes the grid's cflTimeStep() at
+			 * every step. */
+			Real dt = 0;
+			/** Wall-clock time between steps, also the deadline of a step. */
+			Clock::duration interval = std::chrono::microseconds(16667);
+			/** Grids with a higher priority get the threads first. */
+			int priority = 0;
+			/** Called on the pool thread after every step, e.g. to publish a
+			 * snapshot of the grid. */
+			std::function<void(WaveGrid&)> stepped;
+		};
+
+		struct Stats {
+			double cpuSeconds = 0;
+			int steps = 0;
+			int missedDeadlines = 0;
+		};
+
+		explicit SimulationScheduler(int threads = std::thread::hardware_concurrency())
+		{
+			for (int i = 0; i < std::max(1, threads); i++)
+				m_threads.emplace_back([this] { workerLoop(); });
+		}
+
+		~SimulationScheduler() {
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_wakeup.notify_all();
+			for (auto& thread : m_threads)
+				thread.join();
+			for (auto& sim : m_simulations)
+				sim->grid->setExecutor(defaultExecutor());
+		}
+
+		/*
+		Registers `grid`, its first step is due right away
+
+		The grid is stepped by the pool from now on and must not be touched
+		by other threads until remove(), apart from reading it in the
+		`stepped` callback. Returns the id of the simulation.
+		*/
+		int add(WaveGrid& grid, Options options) {
+			auto sim = std::make_unique<Simulation>(*this);
+			sim->grid = &grid;
+			sim->options = std::move(options);
+			grid.setExecutor(*sim);
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			const int id = m_nextId++;
+			sim->id = id;
+			sim->release = Clock::now();
+			sim->deadline = sim->release + sim->options.interval;
+			m_simulations.push_back(std::move(sim));
+			lock.unlock();
+			m_wakeup.notify_all();
+			return id;
+		}
+
+		// Waits for a running step of the simulation and unregisters it
+		void remove(int id) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto it = std::find_if(m_simulations.begin(), m_simulations.end(),
+				[id](auto const& sim) { return sim->id == id; });
+			if (it == m_simulations.end())
+				return;
+			Simulation* sim = it->get();
+			sim->removed = true;
+			m_wakeup.wait(lock, [sim] { return !sim->running; });
+			sim->grid->setExecutor(defaultExecutor());
+			m_simulations.erase(std::find_if(m_simulations.begin(), m_simulations.end(),
+				[id](auto const& s) { return s->id == id; }));
+		}
+
+		void setPriority(int id, int priority) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			if (Simulation* sim = find(id))
+				sim->options.priority = priority;
+		}
+
+		Stats stats(int id) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			Stats stats;
+			if (Simulation* sim = find(id)) {
+				stats.cpuSeconds = sim->busy.load(std::memory_order_relaxed) * 1e-9;
+				stats.steps = sim->steps;
+				stats.missedDeadlines = sim->missed;
+			}
+			return stats;
+		}
+
+		int concurrency()const {
+			return m_threads.size();
+		}
+
+	private:
+		struct Simulation;
+
+		// Items of one parallelFor() call of a simulation
+		struct Batch {
+			Simulation* sim;
+			std::function<void(int)> const* body;
+			int count;
+			int next = 0;
+			int done = 0;
+		};
+
+		// Executor of a registered grid, hands its items to the pool
+		struct Simulation : Executor {
+			explicit Simulation(SimulationScheduler& scheduler) : scheduler(scheduler) {}
+
+			void parallelFor(int count, std::function<void(int)> const& body) override {
+				scheduler.parallelFor(*this, count, body);
+			}
+			int concurrency()const override {
+				return scheduler.concurrency();
+			}
+
+			SimulationScheduler& scheduler;
+			WaveGrid* grid = nullptr;
+			Options options;
+			int id = 0;
+
+			// guarded by the scheduler mutex
+			Clock::time_point release, deadline;
+			bool running = false;
+			bool removed = false;
+			int steps = 0;
+			int missed = 0;
+
+			// nanoseconds of pool thread time
+			std::atomic<long long> busy{ 0 };
+		};
+
+		Simulation* find(int id) {
+			for (auto& sim : m_simulations)
+				if (sim->id == id)
+					return sim.get();
+			return nullptr;
+		}
+
+		// a before b, higher priority first and then the earlier deadline
+		static bool moreUrgent(Simulation const& a, Simulation const& b) {
+			if (a.options.priority != b.options.priority)
+				return a.options.priority > b.options.priority;
+			return a.deadline < b.deadline;
+		}
+
+		// Most urgent batch with items left, nullptr if there is none
+		Batch* urgentBatch() {
+			Batch* best = nullptr;
+			for (Batch* batch : m_batches)
+				if (batch->next < batch->count && (!best || moreUrgent(*batch->sim, *best->sim)))
+					best = batch;
+			return best;
+		}
+
+		// Most urgent simulation with a step due, nullptr if there is none
+		Simulation* dueSimulation(Clock::time_point now) {
+			Simulation* best = nullptr;
+			for (auto& sim : m_simulations)
+				if (!sim->running && !sim->removed && sim->release <= now && (!best || moreUrgent(*sim, *best)))
+					best = sim.get();
+			return best;
+		}
+
+		// Runs item `i` of `batch` with the lock released, charging its time to the batch's simulation
+		void runItem(std::unique_lock<std::mutex>& lock, Batch* batch, int i) {
+			lock.unlock();
+			Simulation* previous = t_charged;
+			charge(batch->sim);
+			t_inItem = true;
+			(*batch->body)(i);
+			t_inItem = false;
+			charge(previous);
+			lock.lock();
+			if (++batch->done == batch->count)
+				m_wakeup.notify_all();
+		}
+
+		void parallelFor(Simulation& sim, int count, std::function<void(int)> const& body) {
+			// nested calls and calls from outside a step run on the calling thread
+			if (count <= 1 || t_inItem || t_charged != &sim) {
+				for (int i = 0; i < count; i++)
+					body(i);
+				return;
+			}
+
+			Batch batch{ &sim, &body, count };
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_batches.push_back(&batch);
+			m_wakeup.notify_all();
+
+			// help with the most urgent items, of any simulation, until the own ones are done
+			while (batch.done < batch.count) {
+				if (Batch* other = urgentBatch()) {
+					runItem(lock, other, other->next++);
+					continue;
+				}
+				Simulation* previous = t_charged;
+				charge(nullptr);
+				m_wakeup.wait(lock, [&] { return batch.done == batch.count || urgentBatch(); });
+				charge(previous);
+			}
+			m_batches.erase(std::find(m_batches.begin(), m_batches.end(), &batch));
+		}
+
+		void step(std::unique_lock<std::mutex>& lock, Simulation* sim) {
+			sim->running = true;
+			lock.unlock();
+
+			charge(sim);
+			// a resized grid has another CFL step
+			const Real dt = sim->options.dt > 0 ? sim->options.dt : sim->grid->cflTimeStep();
+			sim->grid->timeStep(dt);
+			if (sim->options.stepped)
+				sim->options.stepped(*sim->grid);
+			charge(nullptr);
+
+			lock.lock();
+			auto now = Clock::now();
+			sim->running = false;
+			sim->steps++;
+			if (now > sim->deadline)
+				sim->missed++;
+			sim->release += sim->options.interval;
+			if (sim->release < now)
+				sim->release = now;
+			sim->deadline = sim->release + sim->options.interval;
+			m_wakeup.notify_all();
+		}
+
+		void workerLoop() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			while (!m_stop) {
+				if (Batch* batch = urgentBatch()) {
+					runItem(lock, batch, batch->next++);
+					continue;
+				}
+
+				auto now = Clock::now();
+				if (Simulation* sim = dueSimulation(now)) {
+					step(lock, sim);
+					continue;
+				}
+
+				// sleep until the next release or until there is work
+				auto next = Clock::time_point::max();
+				for (auto& sim : m_simulations)
+					if (!sim->running && !sim->removed)
+						next = std::min(next, sim->release);
+				if (next == Clock::time_point::max())
+					m_wakeup.wait(lock);
+				else
+					m_wakeup.wait_until(lock, next);
+			}
+		}
+
+		// Adds the time since the last call to the simulation charged so far and charges `sim` from now on
+		static void charge(Simulation* sim) {
+			auto now = Clock::now();
+			if (t_charged)
+				t_charged->busy.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(now - t_since).count(),
+					std::memory_order_relaxed);
+			t_charged = sim;
+			t_since = now;
+		}
+
+		// the simulation a pool thread works for and since when
+		static inline thread_local Simulation* t_charged = nullptr;
+		static inline thread_local Clock::time_point t_since;
+		static inline thread_local bool t_inItem = false;
+
+		std::vector<std::thread> m_threads;
+		std::vector<std::unique_ptr<Simulation>> m_simulations;
+		std::vector<Batch*> m_batches;
+		int m_nextId = 0;
+
+		std::mutex m_mutex;
+		std::condition_variable m_wakeup;
+		bool m_stop = false;
+	};
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "WaveGrid.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Lock-free triple buffer for one writer and one reader thread.
+	 *
+	 * The writer fills `back()` and hands it over with `publish()`, the
+	 * reader gets the latest published buffer from `latest()`. Both sides own
+	 * one buffer each, the third one is the hand-over slot swapped with an
+	 * atomic exchange, so neither side ever waits for or tears the other.
+	 */
+	template <class T>
+	class TripleBuffer
+	{
+	public:
+		// writer thread
+		T& back() {
+			return m_buffers[m_back];
+		}
+		void publish() {
+			m_back = m_middle.exchange(m_back | fresh, std::memory_order_acq_rel) & index;
+		}
+
+		// reader thread, the returned buffer stays valid until the next call
+		T const& latest() {
+			if (m_middle.load(std::memory_order_relaxed) & fresh)
+				m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & index;
+			return m_buffers[m_front];
+		}
+		bool hasNew()const {
+			return m_middle.load(std::memory_order_relaxed) & fresh;
+		}
+
+		// setup only, before the threads start
+		std::array<T, 3>& buffers() {
+			return m_buffers;
+		}
+
+	private:
+		static constexpr int index = 3;
+		static constexpr int fresh = 4;
+
+		std::array<T, 3> m_buffers;
+		int m_back = 0;
+		std::atomic<int> m_middle = 1;
+		int m_front = 2;
+	};
+
+	/*
+	 * Hands snapshots of a simulated `WaveGrid` to a render thread.
+	 *
+	 * The simulation thread calls `publish()` after its time steps, which
+	 * copies the grid state into a spare snapshot grid. A grid that did not
+	 * change since the last `publish()`, by its `revision()`, is not copied
+	 * again, and a resized grid is followed, @see WaveGrid::copyStateFrom().
+	 * The render thread calls `latest()` once per frame and evaluates
+	 * `waterSurface()`, the profile buffers and amplitudes of the returned
+	 * grid, which does not change until its next `latest()`. Both threads run
+	 * at their own rates.
+	 */
+	class SnapshotPublisher
+	{
+	public:
+		explicit SnapshotPublisher(WaveGrid const& grid) {
+			WaveGrid::Settings s = grid.m_settings;
+			s.spin_up = false;
+			for (auto& snapshot : m_snapshots.buffers()) {
+				snapshot = std::make_unique<WaveGrid>(s);
+				snapshot->copyStateFrom(grid);
+				// a grid not stepped yet has no profile buffers
+				snapshot->precomputeProfileBuffers();
+			}
+			m_revision = grid.revision();
+		}
+
+		// simulation thread
+		void publish(WaveGrid const& grid) {
+			if (grid.revision() == m_revision)
+				return;
+			m_revision = grid.revision();
+			m_snapshots.back()->copyStateFrom(grid);
+			m_snapshots.publish();
+		}
+
+		// render thread
+		WaveGrid const& latest() {
+			return *m_snapshots.latest();
+		}
+		bool hasNew()const {
+			return m_snapshots.hasNew();
+		}
+
+	private:
+		TripleBuffer<std::unique_ptr<WaveGrid>> m_snapshots;
+		// revision of the grid last published, simulation thread only
+		std::uint64_t m_revision;
+	};
+}
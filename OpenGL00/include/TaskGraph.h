@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "Executor.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Tasks with dependencies between them, run on an `Executor`.
+	 *
+	 * A task starts as soon as all tasks it depends on are done, there is no
+	 * barrier between groups of tasks. Of the ready tasks the one added first
+	 * starts first, so callers add their long tasks early. A thread finishing
+	 * a task continues with a successor it released itself, which keeps the
+	 * data the two share in its cache.
+	 *
+	 * The graph is built with `add()` and `precede()` and may be run several
+	 * times, `clear()` empties it for a different one.
+	 *
+	 * `run()` hands the ready tasks to the executor in waves, one item per
+	 * ready task up to its concurrency. An item works through ready tasks and
+	 * the successors they release and returns as soon as none is ready,
+	 * instead of waiting for tasks still running elsewhere. The next wave
+	 * takes what was released meanwhile. Idle threads so go back to the
+	 * executor, e.g. to the other grids of a `SimulationScheduler`, rather
+	 * than spinning through narrow parts of the graph.
+	 */
+	class TaskGraph
+	{
+	public:
+		int add(std::function<void()> task) {
+			m_tasks.push_back(std::move(task));
+			m_successors.emplace_back();
+			m_dependencies.push_back(0);
+			return m_tasks.size() - 1;
+		}
+
+		// `after` does not start before `before` is done
+		void precede(int before, int after) {
+			m_successors[before].push_back(after);
+			m_dependencies[after]++;
+		}
+
+		void clear() {
+			m_tasks.clear();
+			m_successors.clear();
+			m_dependencies.clear();
+		}
+
+		int size()const {
+			return m_tasks.size();
+		}
+
+		// Runs all tasks and returns once they are done
+		void run(Executor& executor) {
+			const int N = m_tasks.size();
+			if (N == 0)
+				return;
+
+			if (m_pendingSize < N) {
+				m_pending = std::make_unique<std::atomic<int>[]>(N);
+				m_pendingSize = N;
+			}
+			for (int i = 0; i < N; i++) {
+				m_pending[i].store(m_dependencies[i], std::memory_order_relaxed);
+				if (m_dependencies[i] == 0)
+					m_ready.push(i);
+			}
+			m_done.store(0, std::memory_order_relaxed);
+
+			// a busy executor runs the items one after another, the first one
+			// then does all tasks alone
+			while (m_done.load(std::memory_order_acquire) < N) {
+				int ready;
+				{
+					std::lock_guard<std::mutex> guard(m_mutex);
+					ready = m_ready.size();
+				}
+				// nothing running and nothing ready, a cycle in the graph
+				assert(ready > 0);
+				if (ready == 0)
+					break;
+				executor.parallelFor(std::min(ready, executor.concurrency()), [this](int) { work(); });
+			}
+		}
+
+	private:
+		// Runs ready tasks and the successors they release until none is ready
+		void work() {
+			int task = -1;
+			while (true) {
+				if (task < 0) {
+					std::lock_guard<std::mutex> guard(m_mutex);
+					if (m_ready.empty())
+						return;
+					task = m_ready.top();
+					m_ready.pop();
+				}
+
+				m_tasks[task]();
+
+				int next = -1;
+				for (int successor : m_successors[task]) {
+					if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1)
+						continue;
+					if (next < 0) {
+						next = successor;
+					}
+					else {
+						std::lock_guard<std::mutex> guard(m_mutex);
+						m_ready.push(successor);
+					}
+				}
+				m_done.fetch_add(1, std::memory_order_release);
+				task = next;
+			}
+		}
+
+		std::vector<std::function<void()>> m_tasks;
+		std::vector<std::vector<int>> m_successors;
+		std::vector<int> m_dependencies;
+
+		// state of a run
+		std::unique_ptr<std::atomic<int>[]> m_pending;
+		int m_pendingSize = 0;
+		std::priority_queue<int, std::vector<int>, std::greater<int>> m_ready;
+		std::mutex m_mutex;
+		std::atomic<int> m_done{ 0 };
+	};
+}
@@ -0,0 +1,383 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "WaveGrid.h"
+
+namespace WaterWavelets
+{
+	/*
+	 * Variants of one simulation stepped together, e.g. for a sweep over
+	 * incoming spectra or disturbances.
+	 *
+	 * Members share the settings, environment, obstacles, time step and
+	 * profile buffers of one `WaveGrid`, `grid()`, and differ in their
+	 * amplitudes and the amplitudes entering at the domain boundary. The
+	 * member is the innermost index of the amplitudes, so one node of all
+	 * members is a contiguous run. The geometry of a step, the reflected
+	 * foot point of every node and the interpolation weights of the domain
+	 * nodes around it, is computed once into a stencil, cached until dt, the
+	 * grid position or the obstacles change, and applied to all members with
+	 * loops over that run.
+	 *
+	 * A step is linear semi-Lagrangian advection, explicit angular diffusion
+	 * and the sponge layer, the default scheme of `WaveGrid`. The settings
+	 * are restricted to it, without periodic domain, multirate or spin-up.
+	 */
+	class WaveEnsemble
+	{
+	public:
+		WaveEnsemble(WaveGrid::Settings s, int members)
+			: m_grid(restricted(s)), m_members(std::max(1, members)) {
+			const int nodes = nodeCount();
+			m_amplitude.assign(size_t(nodes) * m_members, 0);
+			m_newAmplitude.assign(size_t(nodes) * m_members, 0);
+
+			const int nb = m_grid.gridDim(WaveGrid::Theta) * m_grid.gridDim(WaveGrid::Zeta);
+			m_boundary.resize(size_t(nb) * m_members);
+			for (int itheta = 0; itheta < m_grid.gridDim(WaveGrid::Theta); itheta++)
+				for (int izeta = 0; izeta < m_grid.gridDim(WaveGrid::Zeta); izeta++)
+					for (int m = 0; m < m_members; m++)
+						setBoundaryAmplitude(m, itheta, izeta, m_grid.defaultAmplitude(itheta, izeta));
+		}
+
+		int members()const {
+			return m_members;
+		}
+
+		// Grid providing environment, obstacles, time and profile buffers of all members
+		WaveGrid& grid() {
+			return m_grid;
+		}
+		WaveGrid const& grid()const {
+			return m_grid;
+		}
+
+		Real cflTimeStep()const {
+			return m_grid.cflTimeStep();
+		}
+
+		Real& amplitude(int member, int ix, int iy, int itheta, int izeta) {
+			return m_amplitude[size_t(node(ix, iy, itheta, izeta)) * m_members + member];
+		}
+		Real amplitude(int member, int ix, int iy, int itheta, int izeta)const {
+			return m_amplitude[size_t(node(ix, iy, itheta, izeta)) * m_members + member];
+		}
+
+		// Amplitude of a member outside of the domain, WaveGrid::defaultAmplitude() unless set
+		void setBoundaryAmplitude(int member, int itheta, int izeta, Real amplitude) {
+			m_boundary[size_t(itheta * m_grid.gridDim(WaveGrid::Zeta) + izeta) * m_members + member] = amplitude;
+		}
+
+		/*
+		Changes the resolution like WaveGrid::resize() with every member
+		remapped the same way. A boundary amplitude keeps its deviation from
+		WaveGrid::defaultAmplitude(), averaged over the old directions.
+		Resize the ensemble, not its grid().
+		*/
+		void resize(int n_x, int n_theta) {
+			const int n0 = m_grid.gridDim(WaveGrid::X), ntheta0 = m_grid.gridDim(WaveGrid::Theta);
+			const int nzeta = m_grid.gridDim(WaveGrid::Zeta);
+			if (n_x == n0 && n_theta == ntheta0)
+				return;
+
+			// each member through a grid of its own, the remap is WaveGrid's
+			WaveGrid member(m_grid.settings(), m_grid.environment().data());
+			member.setExecutor(m_grid.executor());
+			std::vector<Real> amplitude;
+			for (int m = 0; m < m_members; m++) {
+				extract(m, member);
+				member.resize(n_x, n_theta);
+				Grid const& grid = member.amplitudes();
+				if (m == 0)
+					amplitude.resize(size_t(grid.size()) * m_members);
+				for (int ix = 0; ix < n_x; ix++)
+					for (int iy = 0; iy < n_x; iy++)
+						for (int itheta = 0; itheta < n_theta; itheta++)
+							for (int izeta = 0; izeta < nzeta; izeta++)
+								amplitude[size_t(((ix * n_x + iy) * n_theta + itheta) * nzeta + izeta) * m_members + m] =
+									grid(ix, iy, itheta, izeta);
+			}
+
+			// boundary amplitudes as deviations from the default, which follows the directions
+			std::vector<Real> boundary(size_t(n_theta) * nzeta * m_members);
+			auto overlaps = WaveGrid::cellOverlaps(ntheta0, n_theta);
+			std::vector<Real> deviation(m_members);
+			for (int jtheta = 0; jtheta < n_theta; jtheta++) {
+				for (int izeta = 0; izeta < nzeta; izeta++) {
+					std::fill(deviation.begin(), deviation.end(), Real(0));
+					for (auto [itheta, w] : overlaps[jtheta])
+						for (int m = 0; m < m_members; m++)
+							deviation[m] += w * (m_boundary[size_t(itheta * nzeta + izeta) * m_members + m] -
+								m_grid.defaultAmplitude(itheta, izeta));
+					for (int m = 0; m < m_members; m++)
+						boundary[size_t(jtheta * nzeta + izeta) * m_members + m] = member.defaultAmplitude(jtheta, izeta) + deviation[m];
+				}
+			}
+
+			m_grid.resize(n_x, n_theta);
+			m_amplitude = std::move(amplitude);
+			m_newAmplitude.assign(m_amplitude.size(), 0);
+			m_boundary = std::move(boundary);
+		}
+
+		// WaveGrid::addPointDisturbance() of one member
+		void addPointDisturbance(int member, Vec2 pos, Real val) {
+			int ix = m_grid.posToIdx(pos[WaveGrid::X], WaveGrid::X);
+			int iy = m_grid.posToIdx(pos[WaveGrid::Y], WaveGrid::Y);
+			if (ix >= 0 && ix < m_grid.gridDim(WaveGrid::X) && iy >= 0 && iy < m_grid.gridDim(WaveGrid::Y)) {
+				for (int itheta = 0; itheta < m_grid.gridDim(WaveGrid::Theta); itheta++)
+					amplitude(member, ix, iy, itheta, 0) += val;
+			}
+		}
+
+		/*
+		Advances all members by `dt`, then precomputes the shared profile
+		buffers and advances the time like WaveGrid::timeStep()
+		*/
+		void timeStep(Real dt) {
+			m_grid.updateObstacles();
+			updateStencil(dt);
+
+			advectionPass();
+			std::swap(m_amplitude, m_newAmplitude);
+			diffusionPass(dt);
+			std::swap(m_amplitude, m_newAmplitude);
+			spongePass(dt);
+
+			m_grid.timeStep(dt, false);
+		}
+
+		/*
+		Copies the state of `member` into `out`, a grid built with the same
+		settings, e.g. to render it with waterSurface()
+		*/
+		void extract(int member, WaveGrid& out)const {
+			out.copyStateFrom(m_grid);
+			const int n = m_grid.gridDim(WaveGrid::X);
+			Grid& grid = out.amplitudes();
+			for (int ix = 0; ix < n; ix++)
+				for (int iy = 0; iy < n; iy++)
+					for (int itheta = 0; itheta < m_grid.gridDim(WaveGrid::Theta); itheta++)
+						for (int izeta = 0; izeta < m_grid.gridDim(WaveGrid::Zeta); izeta++)
+							grid(ix, iy, itheta, izeta) = amplitude(member, ix, iy, itheta, izeta);
+			out.touchTiles(out.wholeGrid());
+		}
+
+	private:
+		// one node of the stencil, `source` is a node or -1 - the boundary amplitude index
+		struct StencilEntry {
+			int source;
+			Real weight;
+		};
+		static constexpr int stencilSize = 8;
+
+		// node classes of the mask
+		enum : char { Land, Coast, Water };
+
+		static WaveGrid::Settings restricted(WaveGrid::Settings s) {
+			s.periodic = false;
+			s.multirate = false;
+			s.temporal_block = 1;
+			s.sparse_tiles = false;
+			s.spin_up = false;
+			s.diffusion_theta = 0;
+			s.advection_scheme = WaveGrid::Settings::SemiLagrangian;
+			s.cubic_advection = false;
+			s.pipelined_step = false;
+			return s;
+		}
+
+		int nodeCount()const {
+			return m_grid.gridDim(WaveGrid::X) * m_grid.gridDim(WaveGrid::Y) *
+				m_grid.gridDim(WaveGrid::Theta) * m_grid.gridDim(WaveGrid::Zeta);
+		}
+		int node(int ix, int iy, int itheta, int izeta)const {
+			return ((ix * m_grid.gridDim(WaveGrid::Y) + iy) * m_grid.gridDim(WaveGrid::Theta) + itheta) *
+				m_grid.gridDim(WaveGrid::Zeta) + izeta;
+		}
+
+		// Rebuilds mask and stencil when dt, grid position, obstacles or resolution changed
+		void updateStencil(Real dt) {
+			assert(m_amplitude.size() == size_t(nodeCount()) * m_members);
+			Vec2 origin = m_grid.origin();
+			std::array<Real, 6> key = { dt, origin[WaveGrid::X], origin[WaveGrid::Y],
+				Real(m_grid.obstacles().version()), Real(m_grid.gridDim(WaveGrid::X)),
+				Real(m_grid.gridDim(WaveGrid::Theta)) };
+			if (key == m_stencilKey)
+				return;
+			m_stencilKey = key;
+
+			const int n = m_grid.gridDim(WaveGrid::X);
+			m_mask.resize(n * n);
+			m_stencil.resize(size_t(nodeCount()) * stencilSize);
+			m_stencilCount.resize(nodeCount());
+
+			m_grid.forEachTile(m_grid.wholeGrid(), [&](std::array<int, 4> tile) {
+				for (int ix = tile[0]; ix < tile[1]; ix++) {
+					for (int iy = tile[2]; iy < tile[3]; iy++) {
+						Real ls = m_grid.levelset(ix, iy);
+						m_mask[ix * n + iy] = ls < 0 ? Land : ls < 4 * m_grid.dx(WaveGrid::X) ? Coast : Water;
+						if (ls < 0)
+							continue;
+						for (int itheta = 0; itheta < m_grid.gridDim(WaveGrid::Theta); itheta++)
+							for (int izeta = 0; izeta < m_grid.gridDim(WaveGrid::Zeta); izeta++)
+								buildStencil(ix, iy, itheta, izeta, dt);
+					}
+				}
+			});
+		}
+
+		/*
+		Weights of the linear interpolation at the foot of node (ix, iy, itheta, izeta)
+
+		The same as WaveGrid::interpolatedAmplitude(): linear in x, y and
+		theta over the domain nodes only, normalized by their total weight,
+		and the nearest zeta node.
+		*/
+		void buildStencil(int ix, int iy, int itheta, int izeta, Real dt) {
+			const int n = m_grid.gridDim(WaveGrid::X);
+			const int ntheta = m_grid.gridDim(WaveGrid::Theta);
+			const int nzeta = m_grid.gridDim(WaveGrid::Zeta);
+
+			Vec4 ipos4 = m_grid.posToGrid(m_grid.footPosition({ ix, iy, itheta, izeta }, dt));
+			int jx = (int)floor(ipos4[WaveGrid::X]);
+			int jy = (int)floor(ipos4[WaveGrid::Y]);
+			int jtheta = (int)floor(ipos4[WaveGrid::Theta]);
+			int kzeta = (int)round(ipos4[WaveGrid::Zeta]);
+			Real wx = ipos4[WaveGrid::X] - jx;
+			Real wy = ipos4[WaveGrid::Y] - jy;
+			Real wtheta = ipos4[WaveGrid::Theta] - jtheta;
+
+			StencilEntry* entries = &m_stencil[size_t(node(ix, iy, itheta, izeta)) * stencilSize];
+			int count = 0;
+			double total = 0;
+			for (int a = 0; a < 2; a++) {
+				Real u = a ? wx : 1 - wx;
+				if (u == 0)
+					continue;
+				for (int b = 0; b < 2; b++) {
+					Real v = b ? wy : 1 - wy;
+					if (v == 0 || !m_grid.inDomain(jx + a, jy + b))
+						continue;
+					for (int c = 0; c < 2; c++) {
+						Real w = c ? wtheta : 1 - wtheta;
+						if (w == 0)
+							continue;
+						total += double(u) * v * w;
+
+						// bands outside of the grid are zero
+						if (kzeta < 0 || kzeta >= nzeta)
+							continue;
+						int tx = jx + a, ty = jy + b, ttheta = pos_modulo(jtheta + c, ntheta);
+						bool inside = tx >= 0 && tx < n && ty >= 0 && ty < n;
+						entries[count++] = { inside ? node(tx, ty, ttheta, kzeta) : -1 - (ttheta * nzeta + kzeta),
+							u * v * w };
+					}
+				}
+			}
+			for (int k = 0; k < count; k++)
+				entries[k].weight = Real(entries[k].weight / total);
+			m_stencilCount[node(ix, iy, itheta, izeta)] = count;
+		}
+
+		void advectionPass() {
+			const int n = m_grid.gridDim(WaveGrid::X);
+			const int M = m_members;
+			const int nodesPerColumn = m_grid.gridDim(WaveGrid::Theta) * m_grid.gridDim(WaveGrid::Zeta);
+
+			m_grid.forEachTile(m_grid.wholeGrid(), [&](std::array<int, 4> tile) {
+				for (int ix = tile[0]; ix < tile[1]; ix++) {
+					for (int iy = tile[2]; iy < tile[3]; iy++) {
+						if (m_mask[ix * n + iy] == Land)
+							continue;
+						for (int k = node(ix, iy, 0, 0), end = k + nodesPerColumn; k < end; k++) {
+							Real* out = &m_newAmplitude[size_t(k) * M];
+							std::fill(out, out + M, Real(0));
+							StencilEntry const* entries = &m_stencil[size_t(k) * stencilSize];
+							for (int e = 0; e < m_stencilCount[k]; e++) {
+								int source = entries[e].source;
+								Real const* in = source >= 0 ? &m_amplitude[size_t(source) * M]
+									: &m_boundary[size_t(-1 - source) * M];
+								const Real w = entries[e].weight;
+								for (int m = 0; m < M; m++)
+									out[m] += w * in[m];
+							}
+						}
+					}
+				}
+			});
+		}
+
+		void diffusionPass(Real dt) {
+			const int n = m_grid.gridDim(WaveGrid::X);
+			const int ntheta = m_grid.gridDim(WaveGrid::Theta);
+			const int nzeta = m_grid.gridDim(WaveGrid::Zeta);
+			const int M = m_members;
+
+			m_grid.forEachTile(m_grid.wholeGrid(), [&](std::array<int, 4> tile) {
+				for (int ix = tile[0]; ix < tile[1]; ix++) {
+					for (int iy = tile[2]; iy < tile[3]; iy++) {
+						bool diffuse = m_mask[ix * n + iy] == Water;
+						for (int itheta = 0; itheta < ntheta; itheta++) {
+							for (int izeta = 0; izeta < nzeta; izeta++) {
+								Real const* a = &m_amplitude[size_t(node(ix, iy, itheta, izeta)) * M];
+								Real* out = &m_newAmplitude[size_t(node(ix, iy, itheta, izeta)) * M];
+								if (!diffuse) {
+									std::copy(a, a + M, out);
+									continue;
+								}
+								Real const* next = &m_amplitude[size_t(node(ix, iy, pos_modulo(itheta + 1, ntheta), izeta)) * M];
+								Real const* prev = &m_amplitude[size_t(node(ix, iy, pos_modulo(itheta - 1, ntheta), izeta)) * M];
+								Real gamma = 2 * 0.025 * m_grid.groupSpeed(izeta) * dt * m_grid.idx(WaveGrid::X);
+								for (int m = 0; m < M; m++)
+									out[m] = (1 - gamma) * a[m] + gamma * 0.5 * (next[m] + prev[m]);
+							}
+						}
+					}
+				}
+			});
+		}
+
+		void spongePass(Real dt) {
+			const int nodesPerColumn = m_grid.gridDim(WaveGrid::Theta) * m_grid.gridDim(WaveGrid::Zeta);
+			const int M = m_members;
+			if (m_grid.spongeWidth() <= 0)
+				return;
+
+			m_grid.forEachTile(m_grid.wholeGrid(), [&](std::array<int, 4> tile) {
+				for (int ix = tile[0]; ix < tile[1]; ix++) {
+					for (int iy = tile[2]; iy < tile[3]; iy++) {
+						Real blend = m_grid.spongeBlend(ix, iy, dt);
+						if (blend == 0)
+							continue;
+						for (int b = 0; b < nodesPerColumn; b++) {
+							Real* a = &m_amplitude[size_t(node(ix, iy, 0, 0) + b) * M];
+							Real const* target = &m_boundary[size_t(b) * M];
+							for (int m = 0; m < M; m++)
+								a[m] += blend * (target[m] - a[m]);
+						}
+					}
+				}
+			});
+		}
+
+		WaveGrid m_grid;
+		int m_members;
+
+		// amplitudes and boundary amplitudes, member innermost
+		std::vector<Real> m_amplitude, m_newAmplitude;
+		std::vector<Real> m_boundary;
+
+		// node classes, stencil of every node and the {dt, xmin, ymin, obstacle version,
+		// n_x, n_theta} they are for
+		std::vector<char> m_mask;
+		std::vector<StencilEntry> m_stencil;
+		std::vector<int> m_stencilCount;
+		std::array<Real, 6> m_stencilKey = { -1, 0, 0, 0, 0, 0 };
+	};
+}
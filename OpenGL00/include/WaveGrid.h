@@ -1,11 +1,26 @@
 #pragma once
 
+#include "Checkpoint.h"
+#include "CyclicTridiagonal.h"
 #include "Enviroment.h"
+#include "Executor.h"
 #include "Global.h"
 #include "Grid.h"
+#include "GridTile.h"
+#include "Obstacles.h"
 #include "ProfileBuffer.h"
 #include "Spectrum.h"
+#include "TaskGraph.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
 
 namespace WaterWavelets {
     // ԵõǸ  ڴѭǳ
@@ -69,11 +84,118 @@ namespace WaterWavelets {
              * һģʽ */
             Real initial_time = 100;
 
+            /** Width in cells of the absorbing layer along the domain edges.
+             * Amplitudes in the layer relax towards defaultAmplitude(), which
+             * lets a much smaller domain show the same interior. 0 disables it. */
+            int sponge_width = 0;
+            /** Relaxation rate [1/s] at the outermost cell of the layer. */
+            Real sponge_strength = 4;
+
+            /** Treat x and y as periodic, like theta. The environment, boundary
+             * reflection and the sponge layer are ignored and the amplitude
+             * field tiles seamlessly, which suits open ocean without coast. */
+            bool periodic = false;
+
+            /** Advance every zeta band with its own CFL limited step.
+             * Slow bands take fewer, power-of-two related, substeps and all
+             * bands are in sync at the end of each time step. It only saves
+             * work for time steps of several cflTimeStep(), e.g. one step
+             * per frame, with dt = cflTimeStep() it is a plain step. */
+            bool multirate = false;
+
+            /** Number of time steps timeSteps() advances a spatial tile of
+             * `tile_size` x `tile_size` nodes while it is in cache. Tiles
+             * carry a halo of the cells the steps read, so the result is the
+             * same as single steps. 1 disables the blocking. */
+            int temporal_block = 1;
+            int tile_size = 32;
+
+            /** Skip tiles of `tile_size` nodes whose amplitude, and that of
+             * everything upstream of them, is constant up to
+             * `sparse_threshold`, e.g. sheltered water and directions no
+             * energy arrives from. Needs the semi-Lagrangian scheme without
+             * multirate or periodic domain, it is ignored otherwise. */
+            bool sparse_tiles = false;
+            Real sparse_threshold = 1e-6;
+
+            /** Start from the steady state of the boundary amplitudes and the
+             * environment instead of a calm sea, @see spinUp(). */
+            bool spin_up = false;
+
+            /** Implicitness of the angular diffusion. 0 is the explicit
+             * step, only stable for small dt, 1/2 is Crank-Nicolson and 1
+             * backward Euler, both stable for any dt. */
+            Real diffusion_theta = 0;
+
+            /** Advection scheme. MacCormack and BFECC are second order and
+             * stay sharp on grids half as fine, a step costs about three and
+             * four times a plain semi-Lagrangian step of the same grid. */
+            enum AdvectionScheme {
+                SemiLagrangian,
+                MacCormack,
+                BFECC
+            } advection_scheme = SemiLagrangian;
+            /** Interpolate x and y with Catmull-Rom cubics instead of linearly
+             * during advection. Overshoots are clamped by the limiter. */
+            bool cubic_advection = false;
+
+            /** Run the steps of timeStep() as a graph of tile tasks,
+             * advection, diffusion and sponge layer of a tile following each
+             * other without waiting for the rest of the grid and the profile
+             * buffers computed alongside, @see pipelinedStep(). Same result
+             * as the plain step for one more amplitude grid of memory. Only
+             * for the semi-Lagrangian scheme without multirate, periodic
+             * domain or sparse tiles, it is ignored otherwise. */
+            bool pipelined_step = false;
+
+            /** Split the (theta, zeta) slabs into this many groups and advect
+             * only one group per time step, round robin, each slab by the
+             * time it lags behind, i.e. `amortized_groups` * dt. The advection
+             * of a step then costs 1 / amortized_groups of a full one while
+             * no slab lags by more than amortized_groups - 1 steps, @see
+             * amortizedDt(). waterSurface() samples a lagging slab upstream
+             * by its lag. 1 disables it. Not with multirate, sparse tiles or
+             * pipelined steps. */
+            int amortized_groups = 1;
+
             /** ѡƵ. Currently only PiersonMoskowitz is supported. */
             enum SpectrumType {
                 LinearBasis,
                 PiersonMoskowitz
             } spectrumType = PiersonMoskowitz;
+
+            /** Name of the map in @ref EnvironmentRegistry. Grids using the
+             * same map share its levelset tables. The map keeps its own world
+             * extent, a grid smaller than it covers only a part of it.
+             * Shipped are "harbor" and "island", the latter is mostly open
+             * water where sparse_tiles can skip the calm tiles. */
+            std::string environment = "harbor";
+        };
+
+        /*
+        Camera of the level of detail, @see setView()
+        */
+        struct View {
+            /** Camera position, z is the height above the water. */
+            Vec3 position = { 0, 0, 10 };
+            /** Horizontal view direction and field of view [rad], tiles
+             * outside of it see no band. A field of view of 0 or >= tau looks
+             * all around. */
+            Vec2 direction = { 1, 0 };
+            Real fov = 0;
+            /** Pixels per radian of the image, e.g. its height over the
+             * vertical field of view. */
+            Real pixels_per_radian = 1000;
+            /** A band is visible in a tile while its wavelength projects to
+             * at least this many pixels at the tile's nearest point. */
+            Real min_pixels = 4;
+            /** An invisible band is stepped every d-th step, d the smallest
+             * power of two for which d times its projected wavelength reaches
+             * min_pixels, at most this divider, a power of two too. */
+            int max_divider = 8;
+            /** Stop bands that reach max_divider or leave the field of view
+             * instead of stepping them every max_divider-th step. */
+            bool freeze = false;
         };
 
     public:
@@ -81,17 +203,33 @@ namespace WaterWavelets {
         WaveGridй   һSettings
         s ʼ WaveGrid
         */
-        WaveGrid(Settings s) : m_spectrum(10), m_enviroment(s.size) {
+        WaveGrid(Settings s)
+            : WaveGrid(s, environments().get(s.environment)) {
+            if (!m_enviroment.valid())
+                std::cout << "ERROR::WAVEGRID::UNKNOWN_ENVIRONMENT: " << s.environment << std::endl;
+        }
+        /*
+        Grid on the map `map` instead of the one named in `s`, nested grids
+        are built on the map of their parent this way
+        */
+        WaveGrid(Settings s, std::shared_ptr<const EnvironmentData> const& map)
+            : m_spectrum(10), m_enviroment(map, 2 * s.size / s.n_x) {
 
             // Ŀǰm_amplitudeһn_x * n_x * n_theta * n_zetaArray
             //std::cout << "s.n_x: " << s.n_x << "s.n_x: " << s.n_x << "s.n_theta: " << s.n_theta << "s.zeta: " << s.n_zeta << std::endl;
             
             // s.n_x:100      s.n_x:100      s.n_theta:8      s.n_zeta:1
             // ĴСΪ100 * 100 * 8 * 1
-            m_amplitude.resize(s.n_x, s.n_x, s.n_theta, s.n_zeta);
+            m_amplitude.allocate(s.n_x, s.n_x, s.n_theta, s.n_zeta);
             // s.n_x:100      s.n_x:100      s.n_theta:8      s.n_zeta:1
             // ĴСΪ100 * 100 * 8 * 1
-            m_newAmplitude.resize(s.n_x, s.n_x, s.n_theta, s.n_zeta);
+            m_newAmplitude.allocate(s.n_x, s.n_x, s.n_theta, s.n_zeta);
+            m_pipelined = s.pipelined_step && !s.periodic && !s.multirate && !s.sparse_tiles &&
+                s.advection_scheme == Settings::SemiLagrangian;
+            m_amortizedGroups = !s.multirate && !s.sparse_tiles && !m_pipelined ? std::max(1, s.amortized_groups) : 1;
+            // scratch grid of the MacCormack and BFECC passes and the pipelined step
+            if (s.advection_scheme != Settings::SemiLagrangian || m_pipelined)
+                m_tmpAmplitude.allocate(s.n_x, s.n_x, s.n_theta, s.n_zeta);
             
             // 
             Real zeta_min = m_spectrum.minZeta();   // -5.05889
@@ -111,11 +249,39 @@ namespace WaterWavelets {
                 m_idx[i] = 1.0 / m_dx[i];
             }
 
+            m_settings = s;
             m_time = s.initial_time;
+            m_spongeWidth = std::min(s.sponge_width, s.n_x / 2);
+            m_spongeStrength = s.sponge_strength;
+            m_periodic = s.periodic;
+            m_multirate = s.multirate;
+            m_temporalBlock = std::max(1, s.temporal_block);
+            m_tileSize = std::max(1, s.tile_size);
+            m_sparseTiles = s.sparse_tiles && !s.periodic && !s.multirate &&
+                s.advection_scheme == Settings::SemiLagrangian;
+            m_sparseThreshold = s.sparse_threshold;
+            m_diffusionTheta = s.diffusion_theta;
+            m_advectionScheme = s.advection_scheme;
+            m_cubicAdvection = s.cubic_advection;
             // ֻһΪs.n_zeta = 1
-            m_profileBuffers.resize(s.n_zeta);
+            m_profileBuffers = std::make_shared<std::vector<ProfileBuffer>>(s.n_zeta);
             // 㲨Ⱥٶ
             precomputeGroupSpeeds();
+
+            // obstacle levelset is cached only as far as reflection and diffusion look
+            m_obstacles.resize(s.n_x, Vec2{ m_xmin[X], m_xmin[Y] }, m_dx[X], 6 * m_dx[X]);
+
+            // the tile order needs the obstacles
+            updateTileOrder();
+            firstTouch(m_amplitude);
+            firstTouch(m_newAmplitude);
+            if (m_tmpAmplitude.dimension(X) > 0)
+                firstTouch(m_tmpAmplitude);
+
+            allocateTiles();
+
+            if (s.spin_up)
+                spinUp();
         }
         /*
         ִһβ
@@ -127,13 +293,51 @@ namespace WaterWavelets {
         void timeStep(const Real dt, bool fullUpdate = true) 
         {
             {
-                if (fullUpdate) {
-                    advectionStep(dt);
-                    diffusionStep(dt);
+                if (fullUpdate && m_pipelined) {
+                    // the profile buffers are computed within the step
+                    updateObstacles();
+                    updateTileOrder();
+                    captureChildGhosts();
+                    pipelinedStep(dt, true);
+                    stepChildren(dt);
+                    for (auto& child : m_children)
+                        child->shareProfileBuffers(m_profileBuffers);
+                }
+                else {
+                    if (fullUpdate) {
+                        simulationStep(dt);
+                    }
+                    precomputeProfileBuffers();
                 }
-                precomputeProfileBuffers();
                 m_time += dt;
+                m_revision++;
+            }
+        }
+        /*
+        Advances `count` time steps of constant length `dt`
+
+        Runs blocks of Settings::temporal_block steps with blockedSimulationSteps()
+        where the configuration allows it and single simulation steps otherwise.
+        The profile buffers are computed once at the end.
+        */
+        void timeSteps(const Real dt, int count)
+        {
+            bool blocked = m_temporalBlock > 1 && !m_sparseTiles && !m_periodic && !m_multirate &&
+                m_advectionScheme == Settings::SemiLagrangian && m_children.empty() && m_amortizedGroups == 1 &&
+                !m_viewSet && m_viewLag.empty();
+            while (count > 0) {
+                int k = blocked ? std::min(count, m_temporalBlock) : 1;
+                if (k > 1) {
+                    blockedSimulationSteps(dt, k);
+                }
+                else {
+                    simulationStep(dt);
+                }
+                m_time += k * dt;
+                count -= k;
             }
+            m_revision++;
+            precomputeProfileBuffers();
         }
         /*
         ˮλü
@@ -144,13 +348,18 @@ namespace WaterWavelets {
         */
         std::pair<Vec3, Vec3> waterSurface(Vec2 pos) const 
         {
+            // the finest grid available at `pos` answers
+            for (auto const& child : m_children) {
+                if (child->covers(pos))
+                    return child->waterSurface(pos);
+            }
+
             Vec3 surface = { 0, 0, 0 };
             Vec3 tx = { 0, 0, 0 };
             Vec3 ty = { 0, 0, 0 };
 
             for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
-                Real  zeta = idxToPos(izeta, Zeta);
-                auto& profile = m_profileBuffers[izeta];
+                auto& profile = (*m_profileBuffers)[izeta];
 
                 int  NUM = gridDim(Theta);
                 int  N = 4 * NUM;
@@ -163,7 +372,7 @@ namespace WaterWavelets {
                     Real kdir_x = kdir * pos;
 
                     Vec4 wave_data =
-                        dx * amplitude({ pos[X], pos[Y], angle, zeta }) * profile(kdir_x);
+                        dx * lagFreeAmplitude(pos, angle, izeta) * profile(kdir_x);
 
                     surface +=
                         Vec3{ kdir[0] * wave_data[0], kdir[1] * wave_data[0], wave_data[1] };
@@ -178,12 +387,68 @@ namespace WaterWavelets {
             return { surface, normal };
         }
 
+        /*
+        amplitude() at `pos`, direction `angle` and band izeta brought to the
+        current time
+
+        An amortized slab still holds the field of slabLag() earlier, which
+        has travelled on by the lag times the group speed since. Each of the
+        two slabs around `angle` is read that far upstream, the catch-up its
+        next advection makes apart from reflections, and the two are blended
+        linearly like amplitude() does.
+        */
+        Real lagFreeAmplitude(Vec2 pos, Real angle, int izeta) const {
+            const Real zeta = idxToPos(izeta, Zeta);
+            if (m_slabLag.empty())
+                return amplitude({ pos[X], pos[Y], angle, zeta });
+
+            Real g = posToGrid(angle, Theta);
+            int jtheta = (int)floor(g);
+            Real w = g - jtheta;
+            auto slab = [&](int itheta) {
+                Real theta = idxToPos(itheta, Theta);
+                Real shift = slabLag(pos_modulo(itheta, gridDim(Theta)), izeta) * groupSpeed(izeta);
+                return amplitude({ pos[X] - shift * cosf(theta), pos[Y] - shift * sinf(theta), theta, zeta });
+            };
+            return (1 - w) * slab(jtheta) + w * slab(jtheta + 1);
+        }
+
+        /*
+        waterSurface() of `count` points at once, e.g. the vertices of a mesh,
+        spread over the executor
+        */
+        void waterSurfaces(Vec2 const* pos, int count, std::pair<Vec3, Vec3>* out) const {
+            constexpr int block = 256;
+            m_executor->parallelFor((count + block - 1) / block, [&](int b) {
+                for (int i = b * block; i < std::min(count, (b + 1) * block); i++)
+                    out[i] = waterSurface(pos[i]);
+            });
+        }
+
+        /*
+        Executor of the simulation passes, profile buffers and batched
+        queries of this grid and its nested grids, defaultExecutor() unless
+        set. It has to outlive the grid.
+        */
+        void setExecutor(Executor& executor) {
+            m_executor = &executor;
+            for (auto& child : m_children)
+                child->setExecutor(executor);
+        }
+        Executor& executor() const {
+            return *m_executor;
+        }
+
         /*
         CFLʱ䲽
         첨ƶһԪʱ䣬timeStepúʱ䲽
         */
         Real cflTimeStep() const {
-            return std::min(m_dx[X], m_dx[Y]) / groupSpeed(gridDim(Zeta) - 1);
+            return cflTimeStep(gridDim(Zeta) - 1);
+        }
+        // CFL time step of a single zeta band, used by the multirate scheduler
+        Real cflTimeStep(int izeta) const {
+            return std::min(m_dx[X], m_dx[Y]) / groupSpeed(izeta);
         }
 
         /*
@@ -196,10 +461,11 @@ namespace WaterWavelets {
         һĸһȵĺصĽ
 
         */
-        auto extendedGrid() const
+        template <class G>
+        auto extendedGrid(G const& grid) const
         {
 
-            return [this](int ix, int iy, int itheta, int izeta) {
+            return [this, &grid](int ix, int iy, int itheta, int izeta) {
                 // ƽǶ
                 itheta = pos_modulo(itheta, gridDim(Theta));
 
@@ -210,13 +476,24 @@ namespace WaterWavelets {
 
                 // ģ֮ĵĬֵ
                 if (ix < 0 || ix >= gridDim(X) || iy < 0 || iy >= gridDim(Y)) {
+                    if (m_periodic)
+                        return grid(pos_modulo(ix, gridDim(X)), pos_modulo(iy, gridDim(Y)), itheta, izeta);
+                    // nested grids take their boundary from the parent
+                    int ighost = m_parent ? ghostIndex(ix, iy) : -1;
+                    if (ighost >= 0)
+                        return m_ghost[(ighost * gridDim(Theta) + itheta) * gridDim(Zeta) + izeta];
                     return defaultAmplitude(itheta, izeta);
                 }
 
                 // õУ򷵻ʵֵ
-                return m_amplitude(ix, iy, itheta, izeta);
+                return grid(ix, iy, itheta, izeta);
             };
         }
+        // Extended amplitude grid, see above
+        auto extendedGrid() const
+        {
+            return extendedGrid(m_amplitude);
+        }
 
 
         /*
@@ -233,19 +510,20 @@ namespace WaterWavelets {
         ֮λõֵ
         */
 
-        auto interpolatedAmplitude() const {
-            auto extended_grid = extendedGrid();
+        template <class G, class SpatialInterpolation>
+        auto interpolatedAmplitude(G const& grid, SpatialInterpolation spatial) const {
+            auto extended_grid = extendedGrid(grid);
 
             // úָʾЩУЩ
             // ʹóԱ inDomain  nodePosition жǷλڶ
             auto domain = [this](int ix, int iy, int itheta, int izeta) -> bool {
-                return m_enviroment.inDomain(nodePosition(ix, iy));
+                return inDomain(ix, iy);
             };
 
             // ֵʹԲֵͳֵ
             auto interpolation = InterpolationDimWise(
                 // βֵ    βֵ
-                LinearInterpolation, LinearInterpolation, LinearInterpolation,
+                spatial, spatial, LinearInterpolation,
                 ConstantInterpolation);
 
             // ڴֵ
@@ -258,6 +536,35 @@ namespace WaterWavelets {
                 return interpolated_grid(ipos4[X], ipos4[Y], ipos4[Theta], ipos4[Zeta]);
             };
         }
+        // Linear interpolation of the current amplitude, see above
+        auto interpolatedAmplitude() const {
+            return interpolatedAmplitude(m_amplitude, LinearInterpolation);
+        }
+
+        /*
+        Linear interpolation of the amplitude for periodic domains
+
+        Returns a function (Vec4 -> Real) like interpolatedAmplitude(), but all
+        of x, y and theta wrap around and there is no domain to respect.
+        */
+        auto periodicAmplitude() const {
+            auto periodic_grid = [this](int ix, int iy, int itheta, int izeta) {
+                if (izeta < 0 || izeta >= gridDim(Zeta)) {
+                    return 0.0f;
+                }
+                return m_amplitude(pos_modulo(ix, gridDim(X)), pos_modulo(iy, gridDim(Y)),
+                    pos_modulo(itheta, gridDim(Theta)), izeta);
+            };
+
+            auto interpolated_grid = InterpolationDimWise(
+                LinearInterpolation, LinearInterpolation, LinearInterpolation,
+                ConstantInterpolation)(periodic_grid);
+
+            return [interpolated_grid, this](Vec4 pos4) mutable {
+                Vec4 ipos4 = posToGrid(pos4);
+                return interpolated_grid(ipos4[X], ipos4[Y], ipos4[Theta], ipos4[Zeta]);
+            };
+        }
 
         /*
         ĳ 
@@ -269,6 +576,8 @@ namespace WaterWavelets {
         */
 
         Real amplitude(Vec4 pos4) const {
+            if (m_periodic)
+                return periodicAmplitude()(pos4);
             return interpolatedAmplitude()(pos4);
         }
 
@@ -330,206 +639,1969 @@ namespace WaterWavelets {
                 for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
                     m_amplitude(ix, iy, itheta, 0) += val;
                 }
+                touchTiles({ ix, ix + 1, iy, iy + 1 });
             }
         }
 
-    public:
+        /*
+        Moving obstacles, e.g. ships
+
+        Obstacles are composited with the static environment, changes take
+        effect at the beginning of the next full time step and only the nodes
+        in the swept footprint of changed obstacles are recomputed.
+        */
+        int addObstacle(Obstacle const& obstacle) {
+            return m_obstacles.add(obstacle);
+        }
+        void moveObstacle(int id, Vec2 position, Real angle) {
+            Obstacle obstacle = m_obstacles.get(id);
+            obstacle.position = position;
+            obstacle.angle = angle;
+            m_obstacles.set(id, obstacle);
+        }
+        void removeObstacle(int id) {
+            m_obstacles.remove(id);
+        }
 
         /*
-        Ԥƽ
-        dt һʱ
+        Scrolling simulation window
+        center desired center of the window, e.g. the camera position
+
+        The window moves by whole cells so that its center gets as close as
+        possible to `center`. Amplitudes are addressed toroidally, so no data
+        is copied and only the strip of newly exposed cells is initialized
+        with defaultAmplitude(). The cost is proportional to the strip, a
+        jump by the window size or more starts the whole grid over.
+
+        Returns true if the window moved.
         */
-        
-        void advectionStep(Real dt) {
-            // Բֵ
-            // صǲֵֵ
-            auto amplitude = interpolatedAmplitude();
-            int sum = 0;
-#pragma omp parallel for collapse(2)
-            for (int ix = 0; ix < gridDim(X); ++ix) {
-                for (int iy = 0; iy < gridDim(Y); ++iy) {
-
-                    Vec2 pos = nodePosition(ix, iy);
-                    
-                    // update only points in the domain
-                    if (m_enviroment.inDomain(pos)) {
-                        sum++;
-                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
-                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+        bool recenter(Vec2 center) {
+            std::array<int, 2> shift;
+            for (int dim : { X, Y }) {
+                Real current = 0.5 * (m_xmin[dim] + m_xmax[dim]);
+                // only keeps the cast in range, any such jump exposes the whole grid
+                Real cells = std::clamp(Real(round((center[dim] - current) * m_idx[dim])), Real(-(1 << 30)), Real(1 << 30));
+                shift[dim] = (int)cells;
+            }
+            if (shift[X] == 0 && shift[Y] == 0)
+                return false;
 
-                                Vec4 pos4 = idxToPos({ ix, iy, itheta, izeta });
-                                Vec2 vel = groupVelocity(pos4);
+            for (int dim : { X, Y }) {
+                m_xmin[dim] += shift[dim] * m_dx[dim];
+                m_xmax[dim] += shift[dim] * m_dx[dim];
+            }
+            m_amplitude.roll(shift[X], shift[Y]);
+            m_newAmplitude.roll(shift[X], shift[Y]);
+            m_obstacles.setOrigin(Vec2{ m_xmin[X], m_xmin[Y] });
+
+            // index range [first,last) of exposed cells along `dim`
+            auto exposed = [this, &shift](int dim) {
+                int count = std::min(std::abs(shift[dim]), gridDim(dim));
+                return shift[dim] > 0 ? std::pair{ gridDim(dim) - count, gridDim(dim) }
+                                      : std::pair{ 0, count };
+            };
+            auto [x0, x1] = exposed(X);
+            auto [y0, y1] = exposed(Y);
 
-                                // ڰ׷
-                                Vec4 trace_back_pos4 = pos4;
-                                trace_back_pos4[X] -= dt * vel[X];
-                                trace_back_pos4[Y] -= dt * vel[Y];
+            auto reset = [this](int ix, int iy) {
+                for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                    for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                        m_amplitude(ix, iy, itheta, izeta) = defaultAmplitude(itheta, izeta);
+            };
 
-                                // ע߽
-                                trace_back_pos4 = boundaryReflection(trace_back_pos4);
+            for (int ix = 0; ix < gridDim(X); ix++) {
+                if (ix >= x0 && ix < x1) {
+                    for (int iy = 0; iy < gridDim(Y); iy++)
+                        reset(ix, iy);
+                }
+                else {
+                    for (int iy = y0; iy < y1; iy++)
+                        reset(ix, iy);
+                }
+            }
+            // the tile statistics move with the amplitudes, only the strip is new
+            rollTiles(shift);
+            touchTiles({ x0, x1, 0, gridDim(Y) });
+            touchTiles({ 0, gridDim(X), y0, y1 });
+            return true;
+        }
 
-                                m_newAmplitude(ix, iy, itheta, izeta) = amplitude(trace_back_pos4);
-                            }
+        /*
+        Changes the resolution of a running simulation
+        n_x nodes per spatial dimension
+        n_theta number of directions
+
+        The amplitudes are remapped conservatively, first in x and y and then
+        in the periodic theta: a new cell gets the average of the old cells
+        it overlaps, weighted by the overlap and in x and y restricted to old
+        cells in the domain. The amplitude integrated over the water is so
+        kept, up to the cells that change between land and water. New cells
+        seeing no old water start from defaultAmplitude(). Spacing, group
+        speeds, environment level, obstacle cache and all other caches follow
+        the new resolution, the sponge layer keeps its physical width. Bands
+        lagging behind from setView() keep their lag at the same place. Nested
+        grids get the new number of directions and keep their n_x.
+        */
+        void resize(int n_x, int n_theta) {
+            const int n0 = gridDim(X), ntheta0 = gridDim(Theta), nzeta = gridDim(Zeta);
+            if (n_x == n0 && n_theta == ntheta0)
+                return;
+
+            std::vector<char> oldDomain(n0 * n0);
+            std::vector<Real> oldViewLag = std::move(m_viewLag);
+            for (int ix = 0; ix < n0; ix++)
+                for (int iy = 0; iy < n0; iy++)
+                    oldDomain[ix * n0 + iy] = inDomain(ix, iy);
+            Grid old = std::move(m_amplitude);
+
+            m_spongeWidth = std::min((int)round(m_spongeWidth * Real(n_x) / n0), n_x / 2);
+            setResolution(n_x, n_theta, nzeta);
+
+            // x and y, directions still the old ones
+            auto overlapX = cellOverlaps(n0, n_x);
+            auto overlapTheta = cellOverlaps(ntheta0, n_theta);
+            const int column = ntheta0 * nzeta;
+            std::vector<Real> spatial(size_t(n_x) * n_x * column);
+            std::vector<char> water(n_x * n_x);
+            m_executor->parallelFor(n_x, [&](int jx) {
+                std::vector<Real> sum(column);
+                for (int jy = 0; jy < n_x; jy++) {
+                    std::fill(sum.begin(), sum.end(), Real(0));
+                    Real weight = 0;
+                    for (auto [ix, wx] : overlapX[jx]) {
+                        for (auto [iy, wy] : overlapX[jy]) {
+                            if (!oldDomain[ix * n0 + iy])
+                                continue;
+                            weight += wx * wy;
+                            for (int itheta = 0; itheta < ntheta0; itheta++)
+                                for (int izeta = 0; izeta < nzeta; izeta++)
+                                    sum[itheta * nzeta + izeta] += wx * wy * old(ix, iy, itheta, izeta);
+                        }
+                    }
+                    water[jx * n_x + jy] = weight > 0;
+                    for (int k = 0; k < column; k++)
+                        spatial[(size_t(jx) * n_x + jy) * column + k] = weight > 0 ? sum[k] / weight : 0;
+                }
+            });
+
+            // then the directions
+            m_executor->parallelFor(n_x, [&](int jx) {
+                for (int jy = 0; jy < n_x; jy++) {
+                    Real const* a = &spatial[(size_t(jx) * n_x + jy) * column];
+                    for (int jtheta = 0; jtheta < n_theta; jtheta++) {
+                        for (int izeta = 0; izeta < nzeta; izeta++) {
+                            Real value = 0;
+                            for (auto [itheta, w] : overlapTheta[jtheta])
+                                value += w * a[itheta * nzeta + izeta];
+                            m_amplitude(jx, jy, jtheta, izeta) =
+                                water[jx * n_x + jy] ? value : defaultAmplitude(jtheta, izeta);
                         }
                     }
                 }
+            });
+            copyGrid(m_amplitude, m_newAmplitude);
+            // the remap mixes the slabs, they restart in step
+            m_slabLag.clear();
+            m_amortizedGroup = 0;
+            // a new tile owes the time of the old tile under its centre
+            const int T = parallelTile;
+            const int nt0 = (n0 + T - 1) / T, nt = (n_x + T - 1) / T;
+            if (!oldViewLag.empty()) {
+                auto oldTile = [&](int t) {
+                    int center = t * T + (std::min(n_x, (t + 1) * T) - t * T) / 2;
+                    return std::min(int(std::int64_t(center) * n0 / n_x), n0 - 1) / T;
+                };
+                m_viewLag.assign(nt * nt * nzeta, 0);
+                for (int tx = 0; tx < nt; tx++)
+                    for (int ty = 0; ty < nt; ty++)
+                        for (int izeta = 0; izeta < nzeta; izeta++)
+                            m_viewLag[(tx * nt + ty) * nzeta + izeta] =
+                                oldViewLag[(oldTile(tx) * nt0 + oldTile(ty)) * nzeta + izeta];
             }
-            std::cout <<"ܹУ" << sum << std::endl;
-            std::swap(m_newAmplitude, m_amplitude);
+            touchTiles(wholeGrid());
+
+            for (auto& child : m_children)
+                child->resize(child->gridDim(X), n_theta);
         }
+
         /*
-        Ԥɢ
-        dt һʱ
+        Geometry, caches and storage of a new resolution, used by resize() and
+        copyStateFrom(). The amplitudes are left undefined, the window, the
+        sponge width and the obstacles are kept.
         */
-        void diffusionStep(Real dt) {
-
-            auto grid = extendedGrid();
-
-#pragma omp parallel for collapse(2)
-            for (int ix = 0; ix < gridDim(X); ix++) {
-                for (int iy = 0; iy < gridDim(Y); iy++) {
-
-                    float ls = m_enviroment.levelset(nodePosition(ix, iy));
+        void setResolution(int n_x, int n_theta, int nzeta) {
+            m_settings.sponge_width = m_spongeWidth;
+            m_settings.n_x = n_x;
+            m_settings.n_theta = n_theta;
+            m_dx[X] = (m_xmax[X] - m_xmin[X]) / n_x;
+            m_dx[Y] = (m_xmax[Y] - m_xmin[Y]) / n_x;
+            m_dx[Theta] = (m_xmax[Theta] - m_xmin[Theta]) / n_theta;
+            for (int i = 0; i < 3; i++)
+                m_idx[i] = 1.0 / m_dx[i];
+            m_enviroment = Environment(m_enviroment.data(), 2 * m_settings.size / n_x);
+            m_obstacles.resize(n_x, Vec2{ m_xmin[X], m_xmin[Y] }, m_dx[X], 6 * m_dx[X]);
+            // the callers refresh all tiles
+            m_obstacles.update();
+            precomputeGroupSpeeds();
+            m_tileOrderKey = { 0, 0, -1 };
+            m_blockReachKey = { -1, 0, 0, 0 };
+            m_blockTiles.clear();
+            m_tileGeometryKey = { 0, 0, -1 };
+            updateTileOrder();
+
+            m_amplitude.allocate(n_x, n_x, n_theta, nzeta);
+            m_newAmplitude.allocate(n_x, n_x, n_theta, nzeta);
+            firstTouch(m_amplitude);
+            firstTouch(m_newAmplitude);
+            if (m_tmpAmplitude.dimension(X) > 0) {
+                m_tmpAmplitude.allocate(n_x, n_x, n_theta, nzeta);
+                firstTouch(m_tmpAmplitude);
+            }
+            allocateTiles();
+        }
 
+        /*
+        Nested refined grid
+        s settings of the child, `n_theta` and `n_zeta` have to match this grid
+        center where to place the child, snapped to its cells
+
+        The child starts from the current amplitudes interpolated to its nodes
+        and samples the map of this grid at its own resolution. Every full
+        time step it follows the obstacles of this grid, takes boundary
+        amplitudes from it, subcycles with its own CFL step and is then
+        restricted back to the coarse cells it covers. waterSurface() is
+        answered by the finest grid covering the point, all of them share the
+        profile buffers of the outermost grid.
+        */
+        WaveGrid& addChild(Settings s, Vec2 center) {
+            assert(s.n_theta == gridDim(Theta) && s.n_zeta == gridDim(Zeta));
+            s.initial_time = m_time;
+            s.periodic = false;
+            s.sponge_width = 0;
+
+            m_children.push_back(std::make_unique<WaveGrid>(s, m_enviroment.data()));
+            WaveGrid& child = *m_children.back();
+            child.m_parent = this;
+            child.m_executor = m_executor;
+            child.recenter(center);
+            child.m_obstacles.follow(m_obstacles);
+            child.updateObstacles();
+
+            auto parentAmplitude = interpolatedAmplitude();
+            m_executor->parallelFor(child.gridDim(X), [&](int ix) {
+                auto amplitude = parentAmplitude;
+                for (int iy = 0; iy < child.gridDim(Y); iy++) {
                     for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
                         for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
-
-                            Vec4 pos4 = idxToPos({ ix, iy, itheta, izeta });
-                            Real gamma = 2 * 0.025 * groupSpeed(izeta) * dt * m_idx[X];
-
-                            // do diffusion only if you are 2 grid nodes away from boudnary
-                            if (ls >= 4 * dx(X)) {
-                                m_newAmplitude(ix, iy, itheta, izeta) =
-                                    (1 - gamma) * grid(ix, iy, itheta, izeta) +
-                                    gamma * 0.5 *
-                                    (grid(ix, iy, itheta + 1, izeta) +
-                                        grid(ix, iy, itheta - 1, izeta));
-                            }
-                            else {
-                                m_newAmplitude(ix, iy, itheta, izeta) = grid(ix, iy, itheta, izeta);
-                            }
-                            // auto dispersion = [](int i) { return 1.0; };
-                            // Real delta =
-                            //     1e-5 * dt * pow(m_dx[3], 2) * dispersion(waveNumber(izeta));
-                            // 0.5 * delta *
-                            //     (m_amplitude(ix, iy, itheta, izeta + 1) +
-                            //      m_amplitude(ix, iy, itheta, izeta + 1));
+                            child.m_amplitude(ix, iy, itheta, izeta) =
+                                amplitude(child.idxToPos({ ix, iy, itheta, izeta }));
                         }
                     }
                 }
-            }
-            std::swap(m_newAmplitude, m_amplitude);
+            });
+            child.shareProfileBuffers(m_profileBuffers);
+            child.touchTiles(child.wholeGrid());
+            return child;
         }
-        /*
-        Ԥȼļ
 
-        ú  Ԥȼļڲʱ m_time
+        // Is `pos` inside of the grid and away from its boundary layer
+        bool covers(Vec2 pos) const {
+            return pos[X] > m_xmin[X] + m_dx[X] && pos[X] < m_xmax[X] - m_dx[X] &&
+                pos[Y] > m_xmin[Y] + m_dx[Y] && pos[Y] < m_xmax[Y] - m_dx[Y];
+        }
 
+        /*
+        Checkpoints
+        path file to write
+        compress run-length compress the amplitudes, pays off for calm or
+        sheltered water
+
+        Stores settings, time, window position, group speeds, obstacles,
+        amplitudes and the lag of amortized and view steps of this grid and all nested grids in one sequential pass.
+        The amplitudes are the raw storage of the grid, so loadCheckpoint()
+        reads them straight into place. The map itself is not stored, only its
+        name and a fingerprint which have to match when loading.
+
+        Returns false if the file could not be written.
         */
-        void precomputeProfileBuffers() {
-
-            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
-
-                Real zeta_min = idxToPos(izeta, Zeta) - 0.5 * dx(Zeta);
-                Real zeta_max = idxToPos(izeta, Zeta) + 0.5 * dx(Zeta);
+        bool saveCheckpoint(std::string const& path, bool compress = false) const {
+            std::ofstream file(path, std::ios::binary);
+            CheckpointWriter out(file);
+            out.put(checkpointMagic);
+            out.put(checkpointVersion);
+            writeCheckpoint(out, compress);
+            file.flush();
+            if (!out.ok()) {
+                std::cout << "ERROR::CHECKPOINT::WRITE_FAILED: " << path << std::endl;
+                return false;
+            }
+            return true;
+        }
 
-                // define spectrum
+        /*
+        Restores a grid written by saveCheckpoint(), the map has to be
+        registered under the same name with the same content.
 
-                m_profileBuffers[izeta].precompute(m_spectrum, m_time, zeta_min, zeta_max);
+        Returns nullptr if the file can not be read or does not match.
+        */
+        static std::unique_ptr<WaveGrid> loadCheckpoint(std::string const& path) {
+            std::ifstream file(path, std::ios::binary);
+            CheckpointReader in(file);
+            if (in.get<std::uint32_t>() != checkpointMagic ||
+                in.get<std::uint32_t>() != checkpointVersion) {
+                std::cout << "ERROR::CHECKPOINT::NOT_A_CHECKPOINT: " << path << std::endl;
+                return nullptr;
+            }
+            auto grid = readCheckpoint(in, nullptr);
+            if (!grid) {
+                std::cout << "ERROR::CHECKPOINT::READ_FAILED: " << path << std::endl;
+                return nullptr;
             }
+            grid->precomputeProfileBuffers();
+            return grid;
         }
-        /*
-        Ԥȼٶ
 
-        㵱ǰѡĲ׵ ԤȺٶ
+        /*
+        Copies everything waterSurface() and amplitude() read from `grid`,
+        which has to be built with the same settings: amplitudes, window,
+        time, profile buffers, obstacles, step lags and nested grids. The buffers of
+        this grid are reused, so repeated copies do not allocate. Should
+        `grid` have been resized since, this grid takes over its resolution.
+        The sparse tile statistics are copied along instead of recomputed,
+        so the amplitudes are read once.
         */
-        void precomputeGroupSpeeds() {
-            // zetaĳ涨groupSpeedsĸ
-            m_groupSpeeds.resize(gridDim(Zeta));
-            // 
-            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+        void copyStateFrom(WaveGrid const& grid) {
+            assert(grid.gridDim(Zeta) == gridDim(Zeta));
+            if (grid.gridDim(X) != gridDim(X) || grid.gridDim(Theta) != gridDim(Theta)) {
+                m_xmin = grid.m_xmin;
+                m_xmax = grid.m_xmax;
+                m_spongeWidth = grid.m_spongeWidth;
+                setResolution(grid.gridDim(X), grid.gridDim(Theta), gridDim(Zeta));
+            }
+            copyGrid(grid.m_amplitude, m_amplitude);
+            // nested grids share the buffers of the outermost one
+            if (!m_parent)
+                *m_profileBuffers = *grid.m_profileBuffers;
+            m_xmin = grid.m_xmin;
+            m_xmax = grid.m_xmax;
+            m_time = grid.m_time;
+            m_obstacles = grid.m_obstacles;
+            m_ghost = grid.m_ghost;
+            m_slabLag = grid.m_slabLag;
+            m_amortizedGroup = grid.m_amortizedGroup;
+            m_viewStep = grid.m_viewStep;
+            m_viewLag = grid.m_viewLag;
+            if (m_sparseTiles && grid.m_sparseTiles && m_tileSize == grid.m_tileSize) {
+                m_tileMin = grid.m_tileMin;
+                m_tileMax = grid.m_tileMax;
+                // only m_amplitude is copied, m_newAmplitude is stale here
+                m_tileSynced.assign(grid.m_tileSynced.size(), false);
+                m_tileLand = grid.m_tileLand;
+                m_tileGeometryKey = grid.m_tileGeometryKey;
+                m_revision++;
+            }
+            else {
+                touchTiles(wholeGrid());
+            }
 
-                Real zeta_min = idxToPos(izeta, Zeta) - 0.5 * dx(Zeta);
-                //std::cout << "izeta: " << izeta << std::endl;
-                //std::cout << "Zeta: " << Zeta << std::endl;
-                //std::cout << " 0.5 * dx(Zeta): " << 0.5 * dx(Zeta) << std::endl;
-                //std::cout << "zeta_min: " << zeta_min << std::endl;
+            if (m_children.size() > grid.m_children.size())
+                m_children.resize(grid.m_children.size());
+            for (size_t i = 0; i < grid.m_children.size(); i++) {
+                WaveGrid const& source = *grid.m_children[i];
+                if (i == m_children.size() || m_children[i]->m_amplitude.size() != source.m_amplitude.size()) {
+                    Settings s = source.m_settings;
+                    s.spin_up = false;
+                    auto child = std::make_unique<WaveGrid>(s, m_enviroment.data());
+                    child->m_parent = this;
+                    if (i == m_children.size())
+                        m_children.push_back(std::move(child));
+                    else
+                        m_children[i] = std::move(child);
+                }
+                m_children[i]->shareProfileBuffers(m_profileBuffers);
+                m_children[i]->copyStateFrom(source);
+            }
+        }
 
-                Real zeta_max = idxToPos(izeta, Zeta) + 0.5 * dx(Zeta);
+    public:
 
-                auto result = integrate(100, zeta_min, zeta_max, [&](Real zeta) -> Vec2 {
-                    // 㲨 
-                    Real waveLength = pow(2, zeta);
-                    // 㲨
-                    Real waveNumber = tau / waveLength;
-                    // 㲨˵ٶ cg
-                    Real cg = 0.5 * sqrt(9.81 / waveNumber);
-                    // 㲨ܶ
-                    Real density = m_spectrum(zeta);
-                    return { cg * density, density };
-                    });
+        /*
+        Simulation part of one time step
+        dt time of one step
 
-                m_groupSpeeds[izeta] =
-                    3 /*the 3 should not be here !!!*/ * result[0] / result[1];
+        Advection, diffusion and the sponge layer of this grid followed by the
+        subcycled steps of all nested grids.
+        */
+        void simulationStep(Real dt) {
+            updateObstacles();
+            updateTileOrder();
+            captureChildGhosts();
+            if (m_sparseTiles) {
+                sparseStep(dt);
             }
-        
+            else if (m_multirate) {
+                multirateStep(dt);
+            }
+            else if (m_pipelined) {
+                // includes the sponge layer
+                pipelinedStep(dt, false);
+                stepChildren(dt);
+                return;
+            }
+            else if (m_amortizedGroups > 1) {
+                advectionStep(amortizedDt(dt));
+                diffusionStep(dt);
+            }
+            else if (m_viewSet || !m_viewLag.empty()) {
+                viewStep(dt);
+            }
+            else {
+                advectionStep(dt);
+                diffusionStep(dt);
+            }
+            spongeStep(dt);
+            if (m_sparseTiles)
+                updateActiveTiles();
+            stepChildren(dt);
         }
 
         /*
-        ߽
-
-        pos4 
-        λڱ߽ڲ˺ط
+        Steady state solver
+        maxSweeps upper bound on the number of sweeps
+        tolerance largest change of an amplitude in a sweep at convergence
+
+        Computes the fixed point A = S(A) of the time step S, advection with
+        reflection followed by diffusion and the sponge layer, for the current
+        environment and boundary amplitudes, with the step cflTimeStep().
+
+        The iteration runs on B = advection(A), the fixed point of advection
+        applied to diffusion and sponge of B. Diffusion and sponge act on
+        single nodes, so they are folded into the field the advection
+        interpolates, and one sweep updates every direction of B in place,
+        visiting the nodes from upstream to downstream like fast sweeping for
+        transport. Incoming waves so cross the whole domain in a single sweep
+        instead of one cell per time step. Directions are coupled by
+        diffusion and reflection. A sweep first updates the even directions
+        of all bands in parallel into m_newAmplitude, then the odd ones,
+        which already read their updated even neighbours. Directions updated
+        at the same time read each other as of the previous sweep, and that
+        coupling is converged by repeating the sweep. A final diffusion and
+        sponge step turns B into A.
+
+        The fixed point is that of linear semi-Lagrangian advection and the
+        explicit diffusion, other schemes settle from it within a few steps.
+        Nested grids are spun up afterwards from their converged parent.
+
+        Returns the number of sweeps done.
+        */
+        int spinUp(int maxSweeps = 200, Real tolerance = 1e-5) {
+            const Real dt = cflTimeStep();
+            const int n = gridDim(X);
+            const int ntheta = gridDim(Theta);
+
+            updateObstacles();
+            // the sweeps never write land, both buffers have to agree there
+            copyGrid(m_amplitude, m_newAmplitude);
+
+            int sweep = 0;
+            std::vector<Real> slabChange(ntheta * gridDim(Zeta));
+            while (sweep < maxSweeps) {
+                for (int parity = 0; parity < 2; parity++) {
+                    const int half = (ntheta + 1 - parity) / 2;
+                    m_executor->parallelFor(half * gridDim(Zeta), [&](int k) {
+                        const int itheta = 2 * (k % half) + parity, izeta = k / half;
+                        const int slab = izeta * ntheta + itheta;
+
+                        // B of this slab as far as swept and of the even slabs once they are done,
+                        // the slabs swept at the same time as of the last sweep
+                        auto current = [this, itheta, parity](int ix, int iy, int jtheta, int jzeta) {
+                            bool fresh = jtheta == itheta || (parity == 1 && jtheta % 2 == 0);
+                            return fresh ? m_newAmplitude(ix, iy, jtheta, jzeta) : m_amplitude(ix, iy, jtheta, jzeta);
+                        };
+                        // diffusion and sponge layer of the current B at one node
+                        auto relaxed = [this, dt, current](int ix, int iy, int jtheta, int jzeta) {
+                            Real a = current(ix, iy, jtheta, jzeta);
+                            float ls = m_periodic ? std::numeric_limits<float>::max() : levelset(ix, iy);
+                            if (ls >= 4 * dx(X)) {
+                                Real gamma = 2 * 0.025 * groupSpeed(jzeta) * dt * m_idx[X];
+                                a = (1 - gamma) * a + gamma * 0.5 *
+                                    (current(ix, iy, pos_modulo(jtheta + 1, gridDim(Theta)), jzeta) +
+                                        current(ix, iy, pos_modulo(jtheta - 1, gridDim(Theta)), jzeta));
+                            }
+                            return a + spongeBlend(ix, iy, dt) * (defaultAmplitude(jtheta, jzeta) - a);
+                        };
+                        auto amplitude = interpolatedAmplitude(relaxed, LinearInterpolation);
+
+                        Real change = 0;
+                        Vec2 kdir = Vec2{ cosf(idxToPos(itheta, Theta)), sinf(idxToPos(itheta, Theta)) };
+                        // nodes are visited in order of their distance along `kdir`
+                        for (int i = 0; i < n; i++) {
+                            int ix = kdir[X] >= 0 ? i : n - 1 - i;
+                            for (int j = 0; j < n; j++) {
+                                int iy = kdir[Y] >= 0 ? j : n - 1 - j;
+                                if (!inDomain(ix, iy))
+                                    continue;
+
+                                Vec4 foot = footPosition({ ix, iy, itheta, izeta }, dt);
+                                Real& a = m_newAmplitude(ix, iy, itheta, izeta);
+                                Real old = a;
+                                Real f = amplitude(foot);
+
+                                // the node is in its own stencil unless the foot is a cell
+                                // away, everything is linear so its weight w is found by
+                                // perturbation and a = f + w (a - old) is solved exactly
+                                a = old + 1;
+                                Real w = amplitude(foot) - f;
+                                a = w < 0.999f ? (f - w * old) / (1 - w) : f;
+                                change = std::max(change, std::abs(a - m_amplitude(ix, iy, itheta, izeta)));
+                            }
+                        }
+                        slabChange[slab] = change;
+                    });
+                }
+                std::swap(m_amplitude, m_newAmplitude);
+                sweep++;
 
-        pos4 ڱ߽ڣ򷵻 
+                if (*std::max_element(slabChange.begin(), slabChange.end()) < tolerance)
+                    break;
+            }
+            diffusionStep(dt);
+            spongeStep(dt);
 
-        õλڱ߽ڲᱻ䣬ζſռλúͲ򶼻ᱻ䵽߽
+            for (auto& child : m_children) {
+                child->fillGhosts();
+                child->spinUp(maxSweeps, tolerance);
+                restrictFrom(*child);
+            }
+            touchTiles(wholeGrid());
+            return sweep;
+        }
 
+        /*
+        Time steps of the slabs advected in the next amortized step
+        dt time of one step
+
+        Slab (itheta, izeta) is in group (itheta + izeta) % m_amortizedGroups,
+        so every group holds directions all around the circle and of every
+        band. The group due gets the time its slabs lag behind, the others
+        zero and are copied by the advection. A slab catches up on exactly
+        the time it missed, after a full round all slabs are at the same time
+        again and none ever lags by more than (groups - 1) * dt. The slabs
+        only read each other where waves are reflected, diffusion and the
+        sponge layer are cheap and run every step with dt on all slabs.
         */
-        Vec4 boundaryReflection(Vec4 pos4) const {
-            Vec2 pos = Vec2{ pos4[X], pos4[Y] };
-            Real ls = m_enviroment.levelset(pos);
-            if (ls >= 0) // ڣҪ
-                return pos4;
-
-            // ߽編ˮƽݶȽ
-            Vec2 n = m_enviroment.levelsetGrad(pos);
+        std::vector<Real> amortizedDt(Real dt) {
+            const int nzeta = gridDim(Zeta);
+            const int slabs = gridDim(Theta) * nzeta;
+            if ((int)m_slabLag.size() != slabs)
+                m_slabLag.assign(slabs, 0);
+
+            std::vector<Real> slabDt(slabs, 0);
+            for (int i = 0; i < slabs; i++) {
+                m_slabLag[i] += dt;
+                if ((i / nzeta + i % nzeta) % m_amortizedGroups == m_amortizedGroup) {
+                    slabDt[i] = m_slabLag[i];
+                    m_slabLag[i] = 0;
+                }
+            }
+            m_amortizedGroup = (m_amortizedGroup + 1) % m_amortizedGroups;
+            return slabDt;
+        }
+        // Time the amplitudes of slab (itheta, izeta) lag behind the grid, 0 unless steps are amortized
+        Real slabLag(int itheta, int izeta) const {
+            int i = itheta * gridDim(Zeta) + izeta;
+            return i < (int)m_slabLag.size() ? m_slabLag[i] : 0;
+        }
+        /*
+        Entry of `bandDt` for slab (itheta, izeta), it holds a step for
+        every zeta band or, from amortizedDt(), for every slab
+        */
+        Real stepOf(std::vector<Real> const& bandDt, int itheta, int izeta) const {
+            return (int)bandDt.size() == gridDim(Zeta) ? bandDt[izeta] : bandDt[itheta * gridDim(Zeta) + izeta];
+        }
 
-            Real theta = pos4[Theta];
-            Vec2 kdir = Vec2{ cosf(theta), sinf(theta) };
+        /*
+        Time steps of the bands of every tile in the next step, @see setView()
+        dt time of one step
+        Fills m_viewDt[tx * nt + ty][izeta]
+
+        The tiles are those of forEachTile(). A band with divider d is due in
+        every d-th step, staggered over the tiles so the slowed work is spread
+        evenly over the steps, and then advances by the time it lags behind,
+        at most max_divider * dt. Without a view every band is due and the
+        lagging ones catch up, after which the table is dropped.
+        */
+        void viewDt(Real dt) {
+            const int T = parallelTile;
+            const int n = gridDim(X);
+            const int nt = (n + T - 1) / T;
+            const int nzeta = gridDim(Zeta);
+            if ((int)m_viewLag.size() != nt * nt * nzeta)
+                m_viewLag.assign(nt * nt * nzeta, 0);
+            m_viewDt.resize(nt * nt);
+
+            const Real halfFov = m_view.fov > 0 && m_view.fov < tau ? m_view.fov / 2 : tau;
+            const Vec2 eye = { m_view.position[X], m_view.position[Y] };
+            const Real height = std::abs(m_view.position[2]);
+            const Real maxStep = std::max(1, m_view.max_divider) * dt;
+
+            bool lagging = false;
+            for (int t = 0; t < nt * nt; t++) {
+                std::vector<Real>& tileDt = m_viewDt[t];
+                tileDt.assign(nzeta, 0);
+                const Vec2 lo = { m_xmin[X] + (t / nt) * T * dx(X), m_xmin[Y] + (t % nt) * T * dx(Y) };
+                const Vec2 hi = { m_xmin[X] + std::min(n, (t / nt + 1) * T) * dx(X),
+                                  m_xmin[Y] + std::min(n, (t % nt + 1) * T) * dx(Y) };
+
+                // nearest point of the tile and whether any of it is in the field of view
+                Vec2 nearest = { std::clamp(eye[X], lo[X], hi[X]), std::clamp(eye[Y], lo[Y], hi[Y]) };
+                Real distance = std::sqrt(pow(norm(nearest - eye), 2) + height * height);
+                bool inView = true;
+                if (halfFov < tau) {
+                    Vec2 center = 0.5 * (lo + hi) - eye;
+                    Real radius = 0.5 * norm(hi - lo);
+                    Real c = norm(center);
+                    Real angle = c > 0 ? std::acos(std::clamp(Real((center * m_view.direction) /
+                        (c * norm(m_view.direction))), Real(-1), Real(1))) : 0;
+                    inView = c <= radius || angle - std::asin(radius / c) <= halfFov;
+                }
 
-            // ߽ΧķͲʧ
-            // lsھ߽зž
-            pos = pos - 2.0 * ls * n;
-            kdir = kdir - 2.0 * (kdir * n) * n;
+                for (int izeta = 0; izeta < nzeta; izeta++) {
+                    int divider = 1;
+                    if (m_viewSet) {
+                        Real pixels = waveLength(izeta) / distance * m_view.pixels_per_radian;
+                        divider = m_view.max_divider;
+                        if (inView)
+                            while (divider > 1 && pixels * divider / 2 >= m_view.min_pixels)
+                                divider /= 2;
+                        if (m_view.freeze && divider >= m_view.max_divider && divider > 1)
+                            divider = 0;
+                    }
 
-            Real reflected_theta = atan2(kdir[Y], kdir[X]);
+                    Real& lag = m_viewLag[t * nzeta + izeta];
+                    lag += dt;
+                    if (divider > 0 && (m_viewStep + t) % divider == 0) {
+                        tileDt[izeta] = std::min(lag, maxStep);
+                        lag -= tileDt[izeta];
+                    }
+                    lagging |= lag > 0;
+                }
+            }
+            m_viewStep++;
+            if (!m_viewSet && !lagging)
+                m_viewLag.clear();
+        }
 
-            // Ǽ辭һη˼ֻصС ı߽粻ôЧġ
-            // Բ衣
-            //assert(m_enviroment.inDomain(pos));
+        /*
+        Advection and diffusion with the band steps of viewDt() in every tile
+        dt time of one step
+
+        Both passes run over the tiles of forEachTile(), all advection before
+        any diffusion, so every tile reads the amplitudes of the last step.
+        Advection writes m_newAmplitude and diffusion writes back to
+        m_amplitude, so the slabs not due are left alone in both passes,
+        @see m_skipIdleSlabs, and a frozen tile costs nothing.
+        */
+        void viewStep(Real dt) {
+            const int nt = (gridDim(X) + parallelTile - 1) / parallelTile;
+            viewDt(dt);
+            auto bandDt = [&](std::array<int, 4> tile) -> std::vector<Real> const& {
+                return m_viewDt[(tile[0] / parallelTile) * nt + tile[2] / parallelTile];
+            };
+            auto idle = [&](std::array<int, 4> tile) {
+                auto const& steps = bandDt(tile);
+                return std::all_of(steps.begin(), steps.end(), [](Real step) { return step == 0; });
+            };
 
-            return Vec4{ pos[X], pos[Y], reflected_theta, pos4[Zeta] };
-        
+            m_skipIdleSlabs = true;
+            forEachTile(wholeGrid(), [&](std::array<int, 4> tile) {
+                if (idle(tile))
+                    return;
+                if (m_cubicAdvection) {
+                    semiLagrangianPass(interpolatedAmplitude(m_amplitude, CubicInterpolation), bandDt(tile), 1,
+                        m_newAmplitude, tile);
+                    limitPass(m_amplitude, m_newAmplitude, bandDt(tile), tile);
+                }
+                else {
+                    semiLagrangianPass(interpolatedAmplitude(m_amplitude, LinearInterpolation), bandDt(tile), 1,
+                        m_newAmplitude, tile);
+                }
+            });
+            forEachTile(wholeGrid(), [&](std::array<int, 4> tile) {
+                if (idle(tile))
+                    return;
+                if (m_diffusionTheta > 0)
+                    implicitDiffusionPass(m_newAmplitude, m_amplitude, bandDt(tile), tile);
+                else
+                    diffusionPass(m_newAmplitude, m_amplitude, bandDt(tile), tile);
+            });
+            m_skipIdleSlabs = false;
         }
 
-    public:
-        Real idxToPos(int idx, int dim) const {
-            // m_xmin: ָάϵСλ
-            // idx + 0.5: Ϊ˽λתΪӦλõĵ
-            // m_dx[dim]:  
-            return m_xmin[dim] + (idx + 0.5) * m_dx[dim];
+        /*
+        Multirate advection and diffusion
+        dt time to advance, all bands are in sync afterwards
+
+        Band izeta takes 2^l substeps of dt/2^l where l is the smallest level
+        satisfying its own CFL condition cflTimeStep(izeta). The finest level
+        sets the number of passes over the grid, a band only updates in
+        every 2^(maxLevel - l)-th pass. The zeta bands do not interact, so
+        the passes leave the bands that are not due alone instead of copying
+        them, @see m_bandSkip, and a band costs its own 2^l substeps only.
+        With dt up to cflTimeStep() every level is 0 and this is a plain
+        step, the saving grows with dt as the slow bands stay at few
+        substeps while the fast ones subcycle.
+        */
+        void multirateStep(Real dt) {
+            const int nzeta = gridDim(Zeta);
+            std::vector<int> level(nzeta, 0);
+            int maxLevel = 0;
+            for (int izeta = 0; izeta < nzeta; izeta++) {
+                while (level[izeta] < 16 &&
+                    dt > 1.0001 * cflTimeStep(izeta) * (1 << level[izeta]))
+                    level[izeta]++;
+                maxLevel = std::max(maxLevel, level[izeta]);
+            }
+
+            for (int pass = 0; pass < (1 << maxLevel); pass++) {
+                std::vector<Real> bandDt(nzeta, 0);
+                m_bandSkip.assign(nzeta, true);
+                for (int izeta = 0; izeta < nzeta; izeta++) {
+                    if (pass % (1 << (maxLevel - level[izeta])) == 0) {
+                        bandDt[izeta] = dt / (1 << level[izeta]);
+                        m_bandSkip[izeta] = false;
+                    }
+                }
+                // a pass swaps the buffers twice, so the skipped bands stay valid in m_amplitude
+                advectionStep(bandDt);
+                diffusionStep(bandDt);
+            }
+            m_bandSkip.clear();
         }
-        Vec4 idxToPos(Idx idx) const {
-            return Vec4{ idxToPos(idx[X], X), idxToPos(idx[Y], Y),
-              idxToPos(idx[Theta], Theta), idxToPos(idx[Zeta], Zeta) };
+        // Whether the passes leave band izeta alone in both buffers, @see multirateStep()
+        bool bandSkipped(int izeta) const {
+            return izeta < (int)m_bandSkip.size() && m_bandSkip[izeta];
         }
 
-        Real posToGrid(Real pos, int dim) const {
-            return (pos - m_xmin[dim]) * m_idx[dim] - 0.5;
-        }
-        // λתλ
-        Vec4 posToGrid(Vec4 pos4) const {
+        /*
+        Advection and diffusion restricted to active tiles
+
+        The grid is cut into `tile_size` tiles and the range of the amplitude
+        of every (tile, theta, zeta) slab is kept up to date. A tile is
+        skipped if for each of its slabs all slabs it can read from are the
+        same constant: the upstream tiles within the halo for theta and its
+        diffusion neighbours theta +- 1, and every direction near land where
+        waves are reflected. Constants are preserved by advection and
+        diffusion, so skipping does not change the result beyond the
+        `sparse_threshold`. A tile becomes active again as soon as energy
+        reaches a slab it depends on.
+        */
+        void sparseStep(Real dt) {
+            const int nt = tileCount();
+            const std::vector<Real> bandDt(gridDim(Zeta), dt);
+            const int h = blockHalo(dt);
+            const int ring = (h + m_tileSize - 1) / m_tileSize;
+
+            // geometry changed, newly wet nodes were touched by updateObstacles()
+            std::array<Real, 3> key = { m_xmin[X], m_xmin[Y], Real(m_obstacles.version()) };
+            if (key != m_tileGeometryKey) {
+                m_tileGeometryKey = key;
+                updateTileLand();
+            }
+
+            for (int tx = 0; tx < nt; tx++)
+                for (int ty = 0; ty < nt; ty++)
+                    m_tileSkip[ty + tx * nt] = tileQuiescent(tx, ty, ring);
+
+            if (m_cubicAdvection)
+                sparseAdvection(bandDt, CubicInterpolation);
+            else
+                sparseAdvection(bandDt, LinearInterpolation);
+
+            m_executor->parallelFor(nt * nt, [&](int t) {
+                if (m_tileSkip[t])
+                    return;
+                auto r = tileRange(t / nt, t % nt);
+                if (m_diffusionTheta > 0)
+                    implicitDiffusionPass(m_amplitude, m_newAmplitude, bandDt, r);
+                else
+                    diffusionPass(m_amplitude, m_newAmplitude, bandDt, r);
+            });
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+        template <class SpatialInterpolation>
+        void sparseAdvection(std::vector<Real> const& bandDt, SpatialInterpolation spatial) {
+            const int nt = tileCount();
+            auto amplitude = interpolatedAmplitude(m_amplitude, spatial);
+
+            m_executor->parallelFor(nt * nt, [&](int t) {
+                auto r = tileRange(t / nt, t % nt);
+                if (m_tileSkip[t]) {
+                    // both buffers hold the same values from now on
+                    if (!m_tileSynced[t])
+                        copyRange(m_amplitude, m_newAmplitude, r);
+                    m_tileSynced[t] = true;
+                    return;
+                }
+                semiLagrangianPass(amplitude, bandDt, 1, m_newAmplitude, r);
+                if (m_cubicAdvection)
+                    limitPass(m_amplitude, m_newAmplitude, bandDt, r);
+            });
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+
+        /*
+        Can tile (tx, ty) skip this step
+        ring number of tiles around it the step can read from
+        */
+        bool tileQuiescent(int tx, int ty, int ring) const {
+            const int nt = tileCount();
+            const int n = gridDim(X);
+            const int K = m_spongeWidth;
+
+            // the sponge changes its layer and the parent refreshes the ghost ring
+            auto r = tileRange(tx, ty);
+            bool edge = r[0] == 0 || r[1] == n || r[2] == 0 || r[3] == n;
+            if (m_parent && edge)
+                return false;
+            if (K > 0 && (r[0] < K || r[1] > n - K || r[2] < K || r[3] > n - K))
+                return false;
+
+            bool land = false;
+            for (int dx = -ring; dx <= ring; dx++)
+                for (int dy = -ring; dy <= ring; dy++)
+                    if (inTiles(tx + dx, ty + dy) && m_tileLand[(ty + dy) + (tx + dx) * nt])
+                        land = true;
+
+            // widens [lo, hi] by slab (tx + dx, ty + dy, itheta, izeta)
+            auto extend = [&](int dx, int dy, int itheta, int izeta, Real& lo, Real& hi) {
+                itheta = pos_modulo(itheta, gridDim(Theta));
+                if (!inTiles(tx + dx, ty + dy)) {
+                    // outside of the grid everything is the default amplitude
+                    lo = std::min(lo, defaultAmplitude(itheta, izeta));
+                    hi = std::max(hi, defaultAmplitude(itheta, izeta));
+                    return;
+                }
+                int i = slabIndex(tx + dx, ty + dy, itheta, izeta);
+                lo = std::min(lo, m_tileMin[i]);
+                hi = std::max(hi, m_tileMax[i]);
+            };
+
+            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                if (land) {
+                    // reflection mixes all directions
+                    Real lo = std::numeric_limits<Real>::max();
+                    Real hi = std::numeric_limits<Real>::lowest();
+                    for (int dx = -ring; dx <= ring; dx++)
+                        for (int dy = -ring; dy <= ring; dy++)
+                            for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                                extend(dx, dy, itheta, izeta, lo, hi);
+                    if (hi - lo > m_sparseThreshold)
+                        return false;
+                    continue;
+                }
+
+                for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                    Real lo = std::numeric_limits<Real>::max();
+                    Real hi = std::numeric_limits<Real>::lowest();
+                    for (int jtheta = itheta - 1; jtheta <= itheta + 1; jtheta++) {
+                        Real theta = idxToPos(pos_modulo(jtheta, gridDim(Theta)), Theta);
+                        for (int dx = -ring; dx <= ring; dx++) {
+                            for (int dy = -ring; dy <= ring; dy++) {
+                                // linear interpolation never reads downstream tiles
+                                bool upstream = dx * cosf(theta) + dy * sinf(theta) <= 1e-3f;
+                                if (upstream || m_cubicAdvection)
+                                    extend(dx, dy, jtheta, izeta, lo, hi);
+                            }
+                        }
+                    }
+                    if (hi - lo > m_sparseThreshold)
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        /*
+        Marks the tiles overlapping `range` as changed
+
+        Anything writing to m_amplitude outside of a time step has to call this
+        for the nodes it touched when sparse tiles are enabled.
+        */
+        void touchTiles(std::array<int, 4> range) {
+            m_revision++;
+            if (!m_sparseTiles)
+                return;
+            const int T = m_tileSize;
+            const int nt = tileCount();
+            int tx0 = std::max(range[0], 0) / T, tx1 = std::min((range[1] + T - 1) / T, nt);
+            int ty0 = std::max(range[2], 0) / T, ty1 = std::min((range[3] + T - 1) / T, nt);
+            const int columns = std::max(0, ty1 - ty0);
+            m_executor->parallelFor(std::max(0, tx1 - tx0) * columns, [&](int i) {
+                int tx = tx0 + i / columns;
+                int ty = ty0 + i % columns;
+                m_tileSynced[ty + tx * nt] = false;
+                updateTileStatistics(tx, ty);
+            });
+        }
+        /*
+        Moves the tile statistics along with a roll of the grid by `shift` nodes
+
+        New node i held old node i + shift. A tile not aligned with the old
+        ones gets the union of the ranges of the old tiles it overlaps, which
+        may only keep it from being skipped. Nodes that came from outside of
+        the grid are left to touchTiles().
+        */
+        void rollTiles(std::array<int, 2> shift) {
+            if (!m_sparseTiles)
+                return;
+            const int n = gridDim(X);
+            const int T = m_tileSize;
+            const int nt = tileCount();
+            const int slabs = gridDim(Theta) * gridDim(Zeta);
+            std::vector<Real> lo(m_tileMin.size()), hi(m_tileMax.size());
+            std::vector<char> synced(nt * nt);
+
+            // old tiles [first, last) holding the nodes of new tile `t` along a dimension
+            auto oldTiles = [&](int t, int s) {
+                int a = std::max(0, t * T + s), b = std::min(n, std::min(n, (t + 1) * T) + s);
+                return a < b ? std::pair{ a / T, (b - 1) / T + 1 } : std::pair{ 0, 0 };
+            };
+            m_executor->parallelFor(nt * nt, [&](int t) {
+                auto [ux0, ux1] = oldTiles(t / nt, shift[X]);
+                auto [uy0, uy1] = oldTiles(t % nt, shift[Y]);
+                std::fill_n(lo.begin() + t * slabs, slabs, std::numeric_limits<Real>::max());
+                std::fill_n(hi.begin() + t * slabs, slabs, std::numeric_limits<Real>::lowest());
+                bool same = ux0 < ux1 && uy0 < uy1;
+                for (int ux = ux0; ux < ux1; ux++) {
+                    for (int uy = uy0; uy < uy1; uy++) {
+                        const int u = uy + ux * nt;
+                        same = same && m_tileSynced[u];
+                        for (int k = 0; k < slabs; k++) {
+                            lo[t * slabs + k] = std::min(lo[t * slabs + k], m_tileMin[u * slabs + k]);
+                            hi[t * slabs + k] = std::max(hi[t * slabs + k], m_tileMax[u * slabs + k]);
+                        }
+                    }
+                }
+                synced[t] = same;
+            });
+            m_tileMin.swap(lo);
+            m_tileMax.swap(hi);
+            m_tileSynced.swap(synced);
+        }
+        // Refreshes the statistics of the tiles updated in the last step
+        void updateActiveTiles() {
+            const int nt = tileCount();
+            m_executor->parallelFor(nt * nt, [&](int t) {
+                if (m_tileSkip[t])
+                    return;
+                m_tileSynced[t] = false;
+                updateTileStatistics(t / nt, t % nt);
+            });
+        }
+        // Amplitude range of every slab of tile (tx, ty), only domain nodes count
+        void updateTileStatistics(int tx, int ty) {
+            auto r = tileRange(tx, ty);
+            int i0 = slabIndex(tx, ty, 0, 0);
+            int count = gridDim(Theta) * gridDim(Zeta);
+            std::fill_n(m_tileMin.begin() + i0, count, std::numeric_limits<Real>::max());
+            std::fill_n(m_tileMax.begin() + i0, count, std::numeric_limits<Real>::lowest());
+            for (int ix = r[0]; ix < r[1]; ix++) {
+                for (int iy = r[2]; iy < r[3]; iy++) {
+                    if (!inDomain(ix, iy))
+                        continue;
+                    for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                        for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                            int i = slabIndex(tx, ty, itheta, izeta);
+                            Real a = m_amplitude(ix, iy, itheta, izeta);
+                            m_tileMin[i] = std::min(m_tileMin[i], a);
+                            m_tileMax[i] = std::max(m_tileMax[i], a);
+                        }
+                    }
+                }
+            }
+        }
+        // Flags tiles within one node of land, waves get reflected there
+        void updateTileLand() {
+            const int nt = tileCount();
+            m_executor->parallelFor(nt * nt, [&](int t) {
+                auto r = tileRange(t / nt, t % nt);
+                bool land = false;
+                for (int ix = r[0] - 1; ix <= r[1] && !land; ix++)
+                    for (int iy = r[2] - 1; iy <= r[3] && !land; iy++)
+                        land = !inDomain(ix, iy);
+                m_tileLand[t] = land;
+            });
+        }
+
+        int tileCount() const {
+            return (gridDim(X) + m_tileSize - 1) / m_tileSize;
+        }
+        bool inTiles(int tx, int ty) const {
+            return tx >= 0 && tx < tileCount() && ty >= 0 && ty < tileCount();
+        }
+        std::array<int, 4> tileRange(int tx, int ty) const {
+            const int T = m_tileSize;
+            return { tx * T, std::min((tx + 1) * T, gridDim(X)), ty * T, std::min((ty + 1) * T, gridDim(Y)) };
+        }
+        int slabIndex(int tx, int ty, int itheta, int izeta) const {
+            return izeta + gridDim(Zeta) * (itheta + gridDim(Theta) * (ty + tileCount() * tx));
+        }
+
+        /*
+        Advances nested grids by `dt`, this grid has already been stepped
+
+        Each child follows the obstacles of this grid and takes as many of its
+        own CFL steps as needed. Its boundary ring is sampled from this grid at
+        the start of the step, see captureChildGhosts(), and at its end, and
+        every substep sees the ring linearly interpolated to the time it starts
+        at. The coarse cells under the child are then replaced by the average
+        of its nodes.
+        */
+        void stepChildren(Real dt) {
+            for (auto& child : m_children) {
+                child->m_obstacles.follow(m_obstacles);
+                child->fillGhosts(child->m_ghostEnd);
+                // a step without captured start, e.g. of a new child, holds the end
+                if (child->m_ghostStart.size() != child->m_ghostEnd.size())
+                    child->m_ghostStart = child->m_ghostEnd;
+
+                int  substeps = std::max(1, (int)ceil(dt / child->cflTimeStep()));
+                Real subdt = dt / substeps;
+                for (int i = 0; i < substeps; i++) {
+                    child->blendGhosts(Real(i) / substeps);
+                    child->simulationStep(subdt);
+                    child->m_time += subdt;
+                }
+                child->m_ghostStart.clear();
+                restrictFrom(*child);
+            }
+        }
+
+        // Boundary rings of the children at the start of a step of this grid
+        void captureChildGhosts() {
+            for (auto& child : m_children)
+                child->fillGhosts(child->m_ghostStart);
+        }
+
+        // m_ghost = (1 - w) * m_ghostStart + w * m_ghostEnd
+        void blendGhosts(Real w) {
+            m_ghost.resize(m_ghostEnd.size());
+            for (size_t i = 0; i < m_ghost.size(); i++)
+                m_ghost[i] = (1 - w) * m_ghostStart[i] + w * m_ghostEnd[i];
+        }
+
+        /*
+        Samples the parent amplitude at the ring of cells around this grid
+        */
+        void fillGhosts() {
+            fillGhosts(m_ghost);
+        }
+        void fillGhosts(std::vector<Real>& ghost) const {
+            const int n = gridDim(X);
+            const int g = ghostWidth;
+            const int cells = 2 * (n + 2 * g) * g + 2 * n * g;
+            ghost.resize(cells * gridDim(Theta) * gridDim(Zeta));
+
+            auto parentAmplitude = m_parent->interpolatedAmplitude();
+            m_executor->parallelFor(n + 2 * g, [&](int i) {
+                auto amplitude = parentAmplitude;
+                const int ix = i - g;
+                for (int iy = -g; iy < n + g; iy++) {
+                    if (ix >= 0 && ix < n && iy == 0)
+                        iy = n;
+                    int ighost = ghostIndex(ix, iy);
+                    for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                        for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                            ghost[(ighost * gridDim(Theta) + itheta) * gridDim(Zeta) + izeta] =
+                                amplitude(idxToPos({ ix, iy, itheta, izeta }));
+                        }
+                    }
+                }
+            });
+        }
+
+        /*
+        Index of cell (ix,iy) in the ghost ring, -1 if it is not in the ring
+
+        The ring is stored as four strips: below, above, left and right.
+        */
+        int ghostIndex(int ix, int iy) const {
+            const int n = gridDim(X);
+            const int g = ghostWidth;
+            const int w = n + 2 * g;
+            if (ix < -g || ix >= n + g || iy < -g || iy >= n + g)
+                return -1;
+            if (iy < 0)
+                return (ix + g) * g + (iy + g);
+            if (iy >= n)
+                return w * g + (ix + g) * g + (iy - n);
+            if (ix < 0)
+                return 2 * w * g + iy * g + (ix + g);
+            if (ix >= n)
+                return 2 * w * g + n * g + iy * g + (ix - n);
+            return -1;
+        }
+
+        /*
+        Replaces amplitudes of cells fully covered by `child` with the average
+        of the child nodes inside of them which are in the domain
+        */
+        void restrictFrom(WaveGrid const& child) {
+            auto first = [](Real x) { return (int)ceil(x); };
+            int px0 = std::max(0, first((child.m_xmin[X] - m_xmin[X]) * m_idx[X]));
+            int px1 = std::min(gridDim(X), (int)floor((child.m_xmax[X] - m_xmin[X]) * m_idx[X]));
+            int py0 = std::max(0, first((child.m_xmin[Y] - m_xmin[Y]) * m_idx[Y]));
+            int py1 = std::min(gridDim(Y), (int)floor((child.m_xmax[Y] - m_xmin[Y]) * m_idx[Y]));
+
+            // child nodes inside of [a,b) along `dim`
+            auto nodes = [&child, first](Real a, Real b, int dim) {
+                int i0 = first((a - child.m_xmin[dim]) * child.m_idx[dim] - 0.5);
+                int i1 = first((b - child.m_xmin[dim]) * child.m_idx[dim] - 0.5);
+                return std::pair{ std::max(i0, 0), std::min(i1, child.gridDim(dim)) };
+            };
+
+            m_executor->parallelFor(std::max(0, px1 - px0), [&](int i) {
+                const int px = px0 + i;
+                for (int py = py0; py < py1; py++) {
+                    Real x = m_xmin[X] + px * m_dx[X];
+                    Real y = m_xmin[Y] + py * m_dx[Y];
+                    auto [cx0, cx1] = nodes(x, x + m_dx[X], X);
+                    auto [cy0, cy1] = nodes(y, y + m_dx[Y], Y);
+
+                    std::vector<Real> sum(gridDim(Theta) * gridDim(Zeta), 0);
+                    int count = 0;
+                    for (int cx = cx0; cx < cx1; cx++) {
+                        for (int cy = cy0; cy < cy1; cy++) {
+                            if (!child.inDomain(cx, cy))
+                                continue;
+                            count++;
+                            for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                                for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                                    sum[itheta * gridDim(Zeta) + izeta] += child.m_amplitude(cx, cy, itheta, izeta);
+                        }
+                    }
+                    if (count == 0)
+                        continue;
+
+                    for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                        for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                            m_amplitude(px, py, itheta, izeta) = sum[itheta * gridDim(Zeta) + izeta] / count;
+                }
+            });
+            touchTiles({ px0, px1, py0, py1 });
+        }
+
+        /*
+        Ԥƽ
+        dt һʱ
+        */
+        
+        void advectionStep(Real dt) {
+            advectionStep(std::vector<Real>(gridDim(Zeta), dt));
+        }
+
+        /*
+        Advection step with a separate time step for every zeta band
+        bandDt time step of each band or slab, @see stepOf(), slabs with zero step are just copied
+        */
+        void advectionStep(std::vector<Real> const& bandDt) {
+            if (m_periodic) {
+                periodicAdvectionStep(bandDt);
+                return;
+            }
+
+            if (m_cubicAdvection)
+                advectionStep(bandDt, CubicInterpolation);
+            else
+                advectionStep(bandDt, LinearInterpolation);
+        }
+
+        /*
+        Advection step with the scheme chosen in Settings::advection_scheme
+        bandDt time step of each band
+        spatial interpolation in x and y, LinearInterpolation or CubicInterpolation
+
+        MacCormack and BFECC estimate the error of a semi-Lagrangian step by
+        tracing its result back to the start and compensate half of it. The
+        result at a node is then clamped to the range of the in-domain nodes
+        around its foot point, which keeps the schemes monotone and stops them
+        from pulling values across the coast. The same limiter keeps cubic
+        interpolation from overshooting.
+        */
+        template <class SpatialInterpolation>
+        void advectionStep(std::vector<Real> const& bandDt, SpatialInterpolation spatial) {
+            // forward step, F = SL(A)
+            semiLagrangianPass(interpolatedAmplitude(m_amplitude, spatial), bandDt, 1, m_newAmplitude, wholeGrid());
+
+            if (m_advectionScheme != Settings::SemiLagrangian) {
+                // back to the start, T = SL^-1(F)
+                semiLagrangianPass(interpolatedAmplitude(m_newAmplitude, spatial), bandDt, -1, m_tmpAmplitude, wholeGrid());
+
+                if (m_advectionScheme == Settings::MacCormack) {
+                    // F + (A - T) / 2
+                    errorCompensation(m_newAmplitude, m_tmpAmplitude, m_newAmplitude);
+                }
+                else {
+                    // SL(A + (A - T) / 2)
+                    errorCompensation(m_amplitude, m_tmpAmplitude, m_tmpAmplitude);
+                    semiLagrangianPass(interpolatedAmplitude(m_tmpAmplitude, spatial), bandDt, 1, m_newAmplitude, wholeGrid());
+                }
+            }
+
+            if (m_advectionScheme != Settings::SemiLagrangian || m_cubicAdvection)
+                limitPass(m_amplitude, m_newAmplitude, bandDt, wholeGrid());
+
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+
+        /*
+        One semi-Lagrangian pass over the nodes in the domain
+        amplitude interpolated field to sample at the foot points
+        bandDt time step of each band or slab, @see stepOf(), slabs with zero step copy m_amplitude
+            unless m_skipIdleSlabs is set
+        direction 1 traces back in time, -1 forward
+        out grid receiving the result, Grid or GridTile
+        range node range {ix0, ix1, iy0, iy1} to update
+        */
+        template <class Amplitude, class Out>
+        void semiLagrangianPass(Amplitude amplitude, std::vector<Real> const& bandDt, Real direction, Out& out,
+            std::array<int, 4> range) const {
+            forEachTile(range, [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ++ix) {
+                    for (int iy = tile[2]; iy < tile[3]; ++iy) {
+
+                        // update only points in the domain
+                        if (!inDomain(ix, iy))
+                            continue;
+
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                                if (bandSkipped(izeta))
+                                    continue;
+
+                                const Real dt = stepOf(bandDt, itheta, izeta);
+                                if (dt == 0) {
+                                    if (!m_skipIdleSlabs)
+                                        out(ix, iy, itheta, izeta) = m_amplitude(ix, iy, itheta, izeta);
+                                    continue;
+                                }
+
+                                out(ix, iy, itheta, izeta) = amplitude(footPosition({ ix, iy, itheta, izeta }, direction * dt));
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        /*
+        Foot of the characteristic through node `idx` a time `dt` earlier,
+        reflected at the boundary
+        */
+        Vec4 footPosition(Idx idx, Real dt) const {
+            Vec4 pos4 = idxToPos(idx);
+            Vec2 vel = groupVelocity(pos4);
+
+            // ڰ׷
+            pos4[X] -= dt * vel[X];
+            pos4[Y] -= dt * vel[Y];
+
+            // ע߽
+            return boundaryReflection(pos4);
+        }
+
+        /*
+        out = base + (m_amplitude - traced) / 2 on the nodes in the domain,
+        `out` may alias `base` or `traced`
+        */
+        void errorCompensation(Grid const& base, Grid const& traced, Grid& out) const {
+            forEachTile(wholeGrid(), [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ++ix) {
+                    for (int iy = tile[2]; iy < tile[3]; ++iy) {
+                        if (!inDomain(ix, iy))
+                            continue;
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                                if (!bandSkipped(izeta))
+                                    out(ix, iy, itheta, izeta) = base(ix, iy, itheta, izeta) +
+                                        0.5f * (m_amplitude(ix, iy, itheta, izeta) - traced(ix, iy, itheta, izeta));
+                    }
+                }
+            });
+        }
+
+        /*
+        Clamps `dst` to the range of `src` around the foot point
+
+        The range is taken over the 2x2x2 nodes in x, y and theta enclosing the
+        foot, ignoring nodes outside of the domain. Nodes whose foot sees no
+        domain node at all are left as they are.
+        */
+        template <class Src, class Dst>
+        void limitPass(Src const& src, Dst& dst, std::vector<Real> const& bandDt, std::array<int, 4> range) const {
+            auto grid = extendedGrid(src);
+
+            forEachTile(range, [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ++ix) {
+                    for (int iy = tile[2]; iy < tile[3]; ++iy) {
+                        if (!inDomain(ix, iy))
+                            continue;
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+
+                                const Real dt = stepOf(bandDt, itheta, izeta);
+                                if (dt == 0 || bandSkipped(izeta))
+                                    continue;
+
+                                Vec4 ipos4 = posToGrid(footPosition({ ix, iy, itheta, izeta }, dt));
+                                int jx = (int)floor(ipos4[X]);
+                                int jy = (int)floor(ipos4[Y]);
+                                int jtheta = (int)floor(ipos4[Theta]);
+
+                                Real lo = std::numeric_limits<Real>::max();
+                                Real hi = std::numeric_limits<Real>::lowest();
+                                for (int kx = jx; kx <= jx + 1; kx++) {
+                                    for (int ky = jy; ky <= jy + 1; ky++) {
+                                        if (!inDomain(kx, ky))
+                                            continue;
+                                        for (int ktheta = jtheta; ktheta <= jtheta + 1; ktheta++) {
+                                            Real a = grid(kx, ky, ktheta, izeta);
+                                            lo = std::min(lo, a);
+                                            hi = std::max(hi, a);
+                                        }
+                                    }
+                                }
+                                if (lo <= hi) {
+                                    Real& a = dst(ix, iy, itheta, izeta);
+                                    a = std::clamp(a, lo, hi);
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+        /*
+        Advection step of a periodic domain
+        dt time of one step
+
+        Every node is in the domain and nothing is reflected, so the loop
+        body is the bare semi-Lagrangian trace back and interpolation.
+        */
+        void periodicAdvectionStep(std::vector<Real> const& bandDt) {
+            auto amplitude = periodicAmplitude();
+
+            forEachTile(wholeGrid(), [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ++ix) {
+                    for (int iy = tile[2]; iy < tile[3]; ++iy) {
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+
+                                if (bandSkipped(izeta))
+                                    continue;
+                                const Real dt = stepOf(bandDt, itheta, izeta);
+                                if (dt == 0) {
+                                    m_newAmplitude(ix, iy, itheta, izeta) = m_amplitude(ix, iy, itheta, izeta);
+                                    continue;
+                                }
+                                Vec4 pos4 = idxToPos({ ix, iy, itheta, izeta });
+                                Vec2 vel = groupVelocity(pos4);
+
+                                pos4[X] -= dt * vel[X];
+                                pos4[Y] -= dt * vel[Y];
+
+                                m_newAmplitude(ix, iy, itheta, izeta) = amplitude(pos4);
+                            }
+                        }
+                    }
+                }
+            });
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+        /*
+        Ԥɢ
+        dt һʱ
+        */
+        void diffusionStep(Real dt) {
+            diffusionStep(std::vector<Real>(gridDim(Zeta), dt));
+        }
+        void diffusionStep(std::vector<Real> const& bandDt) {
+            if (m_diffusionTheta > 0)
+                implicitDiffusionPass(m_amplitude, m_newAmplitude, bandDt, wholeGrid());
+            else
+                diffusionPass(m_amplitude, m_newAmplitude, bandDt, wholeGrid());
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+        /*
+        Explicit angular diffusion of the nodes in `range`
+        src, dst grids to read from and write to, Grid or GridTile
+        range node range {ix0, ix1, iy0, iy1}
+        */
+        template <class Src, class Dst>
+        void diffusionPass(Src const& src, Dst& dst, std::vector<Real> const& bandDt, std::array<int, 4> range) const {
+
+            auto grid = extendedGrid(src);
+
+            forEachTile(range, [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ix++) {
+                    for (int iy = tile[2]; iy < tile[3]; iy++) {
+
+                        float ls = m_periodic ? std::numeric_limits<float>::max() : levelset(ix, iy);
+
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                                if (bandSkipped(izeta) || (m_skipIdleSlabs && bandDt[izeta] == 0))
+                                    continue;
+
+                                Vec4 pos4 = idxToPos({ ix, iy, itheta, izeta });
+                                Real gamma = 2 * 0.025 * groupSpeed(izeta) * bandDt[izeta] * m_idx[X];
+
+                                // do diffusion only if you are 2 grid nodes away from boudnary
+                                if (ls >= 4 * dx(X)) {
+                                    dst(ix, iy, itheta, izeta) =
+                                        (1 - gamma) * grid(ix, iy, itheta, izeta) +
+                                        gamma * 0.5 *
+                                        (grid(ix, iy, itheta + 1, izeta) +
+                                            grid(ix, iy, itheta - 1, izeta));
+                                }
+                                else {
+                                    dst(ix, iy, itheta, izeta) = grid(ix, iy, itheta, izeta);
+                                }
+                                // auto dispersion = [](int i) { return 1.0; };
+                                // Real delta =
+                                //     1e-5 * dt * pow(m_dx[3], 2) * dispersion(waveNumber(izeta));
+                                // 0.5 * delta *
+                                //     (m_amplitude(ix, iy, itheta, izeta + 1) +
+                                //      m_amplitude(ix, iy, itheta, izeta + 1));
+                            }
+                        }
+                    }
+                }
+            });
+        }
+        /*
+        Theta-scheme angular diffusion
+        bandDt time step of each band
+
+        With D = gamma / 2 and L the periodic second difference in theta,
+        every (ix, iy, izeta) fiber solves
+
+            (I - theta D L) a' = (I + (1 - theta) D L) a
+
+        where theta = Settings::diffusion_theta. Any theta >= 1/2 is stable
+        for every dt. The systems of all bands of a node are solved together,
+        theta and zeta being the innermost dimensions of the grid they are
+        one contiguous block.
+        */
+        template <class Src, class Dst>
+        void implicitDiffusionPass(Src const& src, Dst& dst, std::vector<Real> const& bandDt, std::array<int, 4> range) const {
+            const int ntheta = gridDim(Theta);
+            const int nzeta = gridDim(Zeta);
+
+            std::vector<Real> D(nzeta), implicitD(nzeta);
+            for (int izeta = 0; izeta < nzeta; izeta++) {
+                D[izeta] = 0.025 * groupSpeed(izeta) * bandDt[izeta] * m_idx[X];
+                implicitD[izeta] = m_diffusionTheta * D[izeta];
+            }
+            CyclicTridiagonal solver;
+            solver.factor(ntheta, implicitD);
+
+            forEachTile(range, [&](std::array<int, 4> tile) {
+                for (int ix = tile[0]; ix < tile[1]; ix++) {
+                    for (int iy = tile[2]; iy < tile[3]; iy++) {
+
+                        float ls = m_periodic ? std::numeric_limits<float>::max() : levelset(ix, iy);
+                        // same two node margin to the boundary as the explicit step
+                        bool diffuse = ls >= 4 * dx(X);
+
+                        for (int itheta = 0; itheta < ntheta; itheta++) {
+                            int iprev = itheta == 0 ? ntheta - 1 : itheta - 1;
+                            int inext = itheta == ntheta - 1 ? 0 : itheta + 1;
+                            for (int izeta = 0; izeta < nzeta; izeta++) {
+                                // the solve keeps the values of a skipped band, its D is 0
+                                if (bandSkipped(izeta) || (m_skipIdleSlabs && D[izeta] == 0))
+                                    continue;
+                                Real a = src(ix, iy, itheta, izeta);
+                                if (diffuse)
+                                    a += (1 - m_diffusionTheta) * D[izeta] *
+                                        (src(ix, iy, iprev, izeta) - 2 * a + src(ix, iy, inext, izeta));
+                                dst(ix, iy, itheta, izeta) = a;
+                            }
+                        }
+                        if (diffuse)
+                            solver.solve(&dst(ix, iy, 0, 0));
+                    }
+                }
+            });
+        }
+        /*
+        Temporally blocked simulation steps
+        dt time of one step
+        k number of steps
+
+        The grid is cut into tiles of `tile_size` nodes. A tile together with
+        a halo of k times its own halo width is copied into a small working
+        copy and advanced k steps there, every step updating a region one halo
+        narrower than the step before, and only the tile itself is written
+        back. Neighbouring tiles recompute the overlapping halos, which costs
+        extra arithmetic but reads and writes the full grid once per k steps.
+        The halo of a tile only covers the foot point reach of the nodes it
+        recomputes, so far reflections at one stretch of coast do not widen
+        the halos of the open water tiles.
+
+        Advection is semi-Lagrangian and the obstacles stay where they are for
+        the k steps, so this matches k calls of simulationStep() up to the
+        interpolation round-off of the order of operations.
+        */
+        void blockedSimulationSteps(Real dt, int k) {
+            const int n = gridDim(X);
+            const int T = m_tileSize;
+            const int tiles = (n + T - 1) / T;
+            const std::vector<Real> bandDt(gridDim(Zeta), dt);
+
+            updateObstacles();
+            blockHalo(dt);
+            const int stencil = m_cubicAdvection ? 2 : 1;
+
+            // halo of every tile: the reach of all tiles its k - 1 outer
+            // steps recompute, grown until it covers itself
+            std::vector<int> halo(tiles * tiles);
+            long long work = 0;
+            for (int tx = 0; tx < tiles; tx++) {
+                for (int ty = 0; ty < tiles; ty++) {
+                    int h = m_tileReach[ty + tx * tiles] + stencil;
+                    for (;;) {
+                        const int g = ((k - 1) * h + T - 1) / T;
+                        int reach = 0;
+                        for (int ux = std::max(0, tx - g); ux <= std::min(tiles - 1, tx + g); ux++)
+                            for (int uy = std::max(0, ty - g); uy <= std::min(tiles - 1, ty + g); uy++)
+                                reach = std::max(reach, m_tileReach[uy + ux * tiles]);
+                        if (reach + stencil <= h)
+                            break;
+                        h = reach + stencil;
+                    }
+                    halo[ty + tx * tiles] = h;
+                    long long wx = std::min(n, (tx + 1) * T + k * h) - std::max(0, tx * T - k * h);
+                    long long wy = std::min(n, (ty + 1) * T + k * h) - std::max(0, ty * T - k * h);
+                    work += wx * wy;
+                }
+            }
+
+            // halos recomputing the grid several times over would only repeat work
+            if (work > 4LL * n * n) {
+                for (int s = 0; s < k; s++)
+                    simulationStep(dt);
+                return;
+            }
+
+            // one pair of working copies per worker, each taking the next tile
+            const int workers = std::max(1, std::min(tiles * tiles, m_executor->concurrency()));
+            if ((int)m_blockTiles.size() < workers)
+                m_blockTiles.resize(workers);
+            std::atomic<int> next{ 0 };
+            m_executor->parallelFor(workers, [&](int worker) {
+                GridTile& a = m_blockTiles[worker][0];
+                GridTile& b = m_blockTiles[worker][1];
+                for (int t = next++; t < tiles * tiles; t = next++) {
+                    const int tx = t / tiles;
+                    const int ty = t % tiles;
+                    const int h = halo[t];
+
+                    // tile grown by `grow` nodes and clipped to the grid
+                    auto region = [&](int grow) {
+                        return std::array<int, 4>{
+                            std::max(0, tx * T - grow), std::min(n, (tx + 1) * T + grow),
+                            std::max(0, ty * T - grow), std::min(n, (ty + 1) * T + grow) };
+                    };
+
+                    auto r = region(k * h);
+                    a.resize(r, gridDim(Theta), gridDim(Zeta));
+                    b.resize(r, gridDim(Theta), gridDim(Zeta));
+                    // b as well: the passes only write domain nodes and copy the
+                    // others, which must not carry values of the previous tile
+                    copyRange(m_amplitude, a, r);
+                    copyRange(m_amplitude, b, r);
+
+                    for (int s = 1; s <= k; s++) {
+                        auto rs = region((k - s) * h);
+                        if (m_cubicAdvection) {
+                            semiLagrangianPass(interpolatedAmplitude(a, CubicInterpolation), bandDt, 1, b, rs);
+                            limitPass(a, b, bandDt, rs);
+                        }
+                        else {
+                            semiLagrangianPass(interpolatedAmplitude(a, LinearInterpolation), bandDt, 1, b, rs);
+                        }
+                        if (m_diffusionTheta > 0)
+                            implicitDiffusionPass(b, a, bandDt, rs);
+                        else
+                            diffusionPass(b, a, bandDt, rs);
+                        spongePass(a, dt, rs);
+                    }
+
+                    copyRange(a, m_newAmplitude, region(0));
+                }
+            });
+            std::swap(m_newAmplitude, m_amplitude);
+        }
+        /*
+        Width in nodes of the halo one time step `dt` reads around the nodes
+        it updates, the interpolation stencil plus the largest distance from
+        a node to its foot point
+
+        Foot points only depend on dt and the geometry. Reflection at a rough
+        levelset can throw them much further than the CFL distance, so their
+        reach is measured per `tile_size` tile and cached until dt, the origin
+        or the obstacles change.
+        */
+        int blockHalo(Real dt) {
+            const int n = gridDim(X);
+            const int T = m_tileSize;
+            const int tiles = (n + T - 1) / T;
+            std::array<Real, 4> key = { dt, m_xmin[X], m_xmin[Y], Real(m_obstacles.version()) };
+            if (key != m_blockReachKey || (int)m_tileReach.size() != tiles * tiles) {
+                std::vector<int> rowReach(n * tiles, 0);
+                m_executor->parallelFor(n, [&](int ix) {
+                    for (int iy = 0; iy < gridDim(Y); iy++) {
+                        int& reach = rowReach[iy / T + ix * tiles];
+                        if (!inDomain(ix, iy))
+                            continue;
+                        for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                                // feet whose stencil misses the grid read default values only
+                                Vec4 foot = posToGrid(footPosition({ ix, iy, itheta, izeta }, dt));
+                                if (foot[X] < -3 || foot[X] > n + 2 || foot[Y] < -3 || foot[Y] > n + 2)
+                                    continue;
+                                reach = std::max(reach, (int)ceil(std::max(fabs(foot[X] - ix), fabs(foot[Y] - iy))));
+                            }
+                        }
+                    }
+                });
+                m_tileReach.assign(tiles * tiles, 0);
+                for (int ix = 0; ix < n; ix++)
+                    for (int ty = 0; ty < tiles; ty++) {
+                        int& reach = m_tileReach[ty + (ix / T) * tiles];
+                        reach = std::max(reach, rowReach[ty + ix * tiles]);
+                    }
+                m_blockReachKey = key;
+                m_blockReach = *std::max_element(m_tileReach.begin(), m_tileReach.end());
+            }
+            return m_blockReach + (m_cubicAdvection ? 2 : 1);
+        }
+        // Copies the nodes in `range` from `src` to `dst`
+        template <class Src, class Dst>
+        void copyRange(Src const& src, Dst& dst, std::array<int, 4> range) const {
+            for (int ix = range[0]; ix < range[1]; ix++)
+                for (int iy = range[2]; iy < range[3]; iy++)
+                    for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                        for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                            dst(ix, iy, itheta, izeta) = src(ix, iy, itheta, izeta);
+        }
+        /*
+        Absorbing layer along the domain edges
+        dt time of one step
+
+        Amplitudes in the outer `sponge_width` cells relax towards
+        defaultAmplitude() with a rate growing quadratically towards the edge.
+        Only the layer itself is visited.
+        */
+        void spongeStep(Real dt) {
+            spongePass(m_amplitude, dt, wholeGrid());
+        }
+        // Fraction of the way to defaultAmplitude() the sponge moves node (ix, iy) in `dt`
+        Real spongeBlend(int ix, int iy, Real dt) const {
+            const int K = m_spongeWidth;
+            const int n = gridDim(X);
+            int d = std::min(std::min(ix, n - 1 - ix), std::min(iy, n - 1 - iy));
+            if (K <= 0 || m_periodic || d >= K)
+                return 0;
+            Real s = Real(K - d) / K;
+            return 1 - exp(-m_spongeStrength * s * s * dt);
+        }
+        // Sponge layer applied in place to the nodes of `grid` in `range`
+        template <class G>
+        void spongePass(G& grid, Real dt, std::array<int, 4> range) const {
+            const int K = m_spongeWidth;
+            const int n = gridDim(X);
+            if (K <= 0 || m_periodic)
+                return;
+
+            auto row = [&](int ix) {
+                for (int iy = range[2]; iy < range[3]; iy++) {
+
+                    // skip the interior of the row
+                    if (ix >= K && ix < n - K && iy >= K && iy < n - K)
+                        iy = n - K;
+                    if (iy >= range[3])
+                        break;
+
+                    Real blend = spongeBlend(ix, iy, dt);
+
+                    for (int itheta = 0; itheta < gridDim(Theta); itheta++) {
+                        for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                            Real& a = grid(ix, iy, itheta, izeta);
+                            a += blend * (defaultAmplitude(itheta, izeta) - a);
+                        }
+                    }
+                }
+            };
+
+            // smaller ranges are tiles the caller already spreads over threads
+            if (range == wholeGrid()) {
+                m_executor->parallelFor(range[1] - range[0], [&](int i) { row(range[0] + i); });
+            }
+            else {
+                for (int ix = range[0]; ix < range[1]; ix++)
+                    row(ix);
+            }
+        }
+        /*
+        Advection, diffusion and sponge layer of one step as a graph of tile tasks
+        dt time of one step
+        profiles also precompute the profile buffers for m_time
+
+        Every parallelTile x parallelTile tile gets an advection task, from
+        m_amplitude into m_newAmplitude, followed by a diffusion task into
+        m_tmpAmplitude and a task applying the sponge layer and the
+        onTileStepped() callback. Diffusion only looks at the theta
+        neighbours of a node, so it may start on a tile as soon as that tile
+        is advected. It writes a third grid because advection of the other
+        tiles still reads the old amplitudes around this one. The profile
+        buffers do not depend on the amplitudes and are split into tasks run
+        alongside, added first as they cost the most. The grids are rotated
+        at the end, leaving both amplitude grids as the plain step does.
+        */
+        void pipelinedStep(Real dt, bool profiles) {
+            const std::vector<Real> bandDt(gridDim(Zeta), dt);
+            const int n = gridDim(X);
+            const int T = parallelTile;
+            const int nt = (n + T - 1) / T;
+            m_stepGraph.clear();
+
+            if (profiles) {
+                constexpr int resolution = 4096, chunk = 512;
+                for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+                    Real zeta_min = idxToPos(izeta, Zeta) - 0.5 * dx(Zeta);
+                    Real zeta_max = idxToPos(izeta, Zeta) + 0.5 * dx(Zeta);
+                    (*m_profileBuffers)[izeta].resize(resolution, zeta_max, 2);
+                    for (int i = 0; i < resolution; i += chunk) {
+                        int end = std::min(resolution, i + chunk);
+                        m_stepGraph.add([this, izeta, zeta_min, zeta_max, i, end] {
+                            (*m_profileBuffers)[izeta].precomputeNodes(m_spectrum, m_time, zeta_min, zeta_max, i, end, 100);
+                        });
+                    }
+                }
+            }
+
+            for (int t : tileOrder(nt)) {
+                const std::array<int, 4> tile = { (t / nt) * T, std::min(n, (t / nt + 1) * T),
+                                                  (t % nt) * T, std::min(n, (t % nt + 1) * T) };
+                int advection = m_stepGraph.add([this, &bandDt, tile] {
+                    if (m_cubicAdvection) {
+                        semiLagrangianPass(interpolatedAmplitude(m_amplitude, CubicInterpolation), bandDt, 1,
+                            m_newAmplitude, tile);
+                        limitPass(m_amplitude, m_newAmplitude, bandDt, tile);
+                    }
+                    else {
+                        semiLagrangianPass(interpolatedAmplitude(m_amplitude, LinearInterpolation), bandDt, 1,
+                            m_newAmplitude, tile);
+                    }
+                });
+                int diffusion = m_stepGraph.add([this, &bandDt, tile] {
+                    if (m_diffusionTheta > 0)
+                        implicitDiffusionPass(m_newAmplitude, m_tmpAmplitude, bandDt, tile);
+                    else
+                        diffusionPass(m_newAmplitude, m_tmpAmplitude, bandDt, tile);
+                });
+                int finish = m_stepGraph.add([this, dt, tile] {
+                    spongePass(m_tmpAmplitude, dt, tile);
+                    if (m_tileStepped)
+                        m_tileStepped(m_tmpAmplitude, tile);
+                });
+                m_stepGraph.precede(advection, diffusion);
+                m_stepGraph.precede(diffusion, finish);
+            }
+
+            m_stepGraph.run(*m_executor);
+
+            // new amplitudes, advected ones as after diffusionStep(), scratch
+            std::swap(m_amplitude, m_tmpAmplitude);
+        }
+
+        /*
+        Sets a function called by pipelined steps for every tile once its new
+        amplitudes are final, e.g. to stage the tile for upload or to gather
+        statistics while other tiles are still stepped
+        callback called as callback(amplitude, tile) from worker threads,
+        amplitude holds the new values in the node range `tile`
+        */
+        void onTileStepped(std::function<void(Grid const&, std::array<int, 4>)> callback) {
+            m_tileStepped = std::move(callback);
+        }
+
+        /*
+        Steps the zeta bands of every tile at a rate the camera can see
+
+        Bands whose wavelength projects to less than View::min_pixels in a
+        tile, or whose tile is outside of the field of view, are advected and
+        diffused only every few steps, or frozen, @see View. They keep the
+        time they missed and catch up in steps of up to max_divider * dt once
+        they are stepped again, so a band coming back into view soon shows
+        the waves that travelled while it was away. The profile buffers, and
+        so the animation of the surface, still advance every step. Waves
+        leaving a slowed tile into a faster one are read at the time the slow
+        tile is at, the camera sees no detail there. Call it again whenever
+        the camera moves. Returns false, without effect, for grids with
+        multirate, sparse tiles, pipelined or amortized steps, a periodic
+        domain or a MacCormack or BFECC scheme.
+        */
+        bool setView(View const& view) {
+            if (m_multirate || m_sparseTiles || m_pipelined || m_amortizedGroups > 1 || m_periodic ||
+                m_advectionScheme != Settings::SemiLagrangian) {
+                std::cout << "ERROR::WAVEGRID::VIEW: level of detail needs plain semi-Lagrangian steps" << std::endl;
+                return false;
+            }
+            m_view = view;
+            m_viewSet = true;
+            return true;
+        }
+        // Back to stepping every band everywhere, lagging bands still catch up
+        void clearView() {
+            m_viewSet = false;
+        }
+        // Time band izeta lags behind in the tile of node (ix, iy), 0 without a view
+        Real viewLag(int ix, int iy, int izeta) const {
+            const int nt = (gridDim(X) + parallelTile - 1) / parallelTile;
+            int i = ((ix / parallelTile) * nt + iy / parallelTile) * gridDim(Zeta) + izeta;
+            return i < (int)m_viewLag.size() ? m_viewLag[i] : 0;
+        }
+
+        /*
+        Ԥȼļ
+
+        ú  Ԥȼļڲʱ m_time
+
+        */
+        void precomputeProfileBuffers() {
+
+            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+
+                Real zeta_min = idxToPos(izeta, Zeta) - 0.5 * dx(Zeta);
+                Real zeta_max = idxToPos(izeta, Zeta) + 0.5 * dx(Zeta);
+
+                // define spectrum
+
+                (*m_profileBuffers)[izeta].precompute(m_spectrum, m_time, zeta_min, zeta_max, 4096, 2, 100, *m_executor);
+            }
+
+            // children share the zeta discretization, hence the buffers too
+            for (auto& child : m_children) {
+                child->shareProfileBuffers(m_profileBuffers);
+            }
+        }
+        // Points this grid and its children at `buffers`, nothing is copied
+        void shareProfileBuffers(std::shared_ptr<std::vector<ProfileBuffer>> const& buffers) {
+            m_profileBuffers = buffers;
+            for (auto& child : m_children) {
+                child->shareProfileBuffers(buffers);
+            }
+        }
+        /*
+        Ԥȼٶ
+
+        㵱ǰѡĲ׵ ԤȺٶ
+        */
+        void precomputeGroupSpeeds() {
+            // zetaĳ涨groupSpeedsĸ
+            m_groupSpeeds.resize(gridDim(Zeta));
+            // 
+            for (int izeta = 0; izeta < gridDim(Zeta); izeta++) {
+
+                Real zeta_min = idxToPos(izeta, Zeta) - 0.5 * dx(Zeta);
+                //std::cout << "izeta: " << izeta << std::endl;
+                //std::cout << "Zeta: " << Zeta << std::endl;
+                //std::cout << " 0.5 * dx(Zeta): " << 0.5 * dx(Zeta) << std::endl;
+                //std::cout << "zeta_min: " << zeta_min << std::endl;
+
+                Real zeta_max = idxToPos(izeta, Zeta) + 0.5 * dx(Zeta);
+
+                auto result = integrate(100, zeta_min, zeta_max, [&](Real zeta) -> Vec2 {
+                    // 㲨 
+                    Real waveLength = pow(2, zeta);
+                    // 㲨
+                    Real waveNumber = tau / waveLength;
+                    // 㲨˵ٶ cg
+                    Real cg = 0.5 * sqrt(9.81 / waveNumber);
+                    // 㲨ܶ
+                    Real density = m_spectrum(zeta);
+                    return { cg * density, density };
+                    });
+
+                m_groupSpeeds[izeta] =
+                    3 /*the 3 should not be here !!!*/ * result[0] / result[1];
+            }
+        
+        }
+
+        /*
+        ߽
+
+        pos4 
+        λڱ߽ڲ˺ط
+
+        pos4 ڱ߽ڣ򷵻 
+
+        õλڱ߽ڲᱻ䣬ζſռλúͲ򶼻ᱻ䵽߽
+
+        */
+        Vec4 boundaryReflection(Vec4 pos4) const {
+            if (m_periodic)
+                return pos4;
+
+            Vec2 pos = Vec2{ pos4[X], pos4[Y] };
+            // value and gradient come from a single levelset fetch
+            auto [ls, grad] = levelsetSample(pos);
+            if (ls >= 0) // ڣҪ
+                return pos4;
+
+            // ߽編ˮƽݶȽ
+            Vec2 n = normalized(grad);
+
+            Real theta = pos4[Theta];
+            Vec2 kdir = Vec2{ cosf(theta), sinf(theta) };
+
+            // ߽ΧķͲʧ
+            // lsھ߽зž
+            pos = pos - 2.0 * ls * n;
+            kdir = kdir - 2.0 * (kdir * n) * n;
+
+            Real reflected_theta = atan2(kdir[Y], kdir[X]);
+
+            // Ǽ辭һη˼ֻصС ı߽粻ôЧġ
+            // Բ衣
+            //assert(m_enviroment.inDomain(pos));
+
+            return Vec4{ pos[X], pos[Y], reflected_theta, pos4[Zeta] };
+        
+        }
+
+    public:
+        Real idxToPos(int idx, int dim) const {
+            // m_xmin: ָάϵСλ
+            // idx + 0.5: Ϊ˽λתΪӦλõĵ
+            // m_dx[dim]:  
+            return m_xmin[dim] + (idx + 0.5) * m_dx[dim];
+        }
+        Vec4 idxToPos(Idx idx) const {
+            return Vec4{ idxToPos(idx[X], X), idxToPos(idx[Y], Y),
+              idxToPos(idx[Theta], Theta), idxToPos(idx[Zeta], Zeta) };
+        }
+
+        Real posToGrid(Real pos, int dim) const {
+            return (pos - m_xmin[dim]) * m_idx[dim] - 0.5;
+        }
+        // λתλ
+        Vec4 posToGrid(Vec4 pos4) const {
             return Vec4{ posToGrid(pos4[X], X), posToGrid(pos4[Y], Y),
               posToGrid(pos4[Theta], Theta), posToGrid(pos4[Zeta], Zeta) };
         }
@@ -575,6 +2647,24 @@ namespace WaterWavelets {
             Real theta = pos4[Theta];
             return cg * Vec2{ cosf(theta), sinf(theta) };
         }
+        /*
+        Levelset of the static environment combined with the obstacles
+        */
+        Real levelset(int ix, int iy) const {
+            Real ls = m_enviroment.levelset(nodePosition(ix, iy));
+            return std::min(ls, m_obstacles.levelset(ix, iy));
+        }
+        bool inDomain(int ix, int iy) const {
+            return levelset(ix, iy) >= 0;
+        }
+        std::pair<Real, Vec2> levelsetSample(Vec2 pos) const {
+            auto env = m_enviroment.sample(pos);
+            if (m_obstacles.empty())
+                return env;
+            auto obs = m_obstacles.sample(pos);
+            return obs.first < env.first ? obs : env;
+        }
+
         Real defaultAmplitude(int itheta, int izeta) const {
             if (itheta == 5 * gridDim(Theta) / 16)
                 return 0.1;
@@ -588,15 +2678,406 @@ namespace WaterWavelets {
         Real dx(int dim) const {
             return m_dx[dim];
         }
+        Real idx(int dim) const {
+            return m_idx[dim];
+        }
+        // Lower corner of the grid in x and y, moves with recenter()
+        Vec2 origin() const {
+            return Vec2{ m_xmin[X], m_xmin[Y] };
+        }
+        int spongeWidth() const {
+            return m_spongeWidth;
+        }
+        // Settings of the current resolution, as written to checkpoints
+        Settings const& settings() const {
+            return m_settings;
+        }
+        Environment const& environment() const {
+            return m_enviroment;
+        }
+        ObstacleLayer const& obstacles() const {
+            return m_obstacles;
+        }
+        /*
+        Changes whenever the state copyStateFrom() copies may have, with every
+        time step and touchTiles() of this grid or a nested one
+        */
+        std::uint64_t revision() const {
+            std::uint64_t r = m_revision;
+            for (auto const& child : m_children)
+                r += child->revision();
+            return r;
+        }
+        // Amplitudes of the nodes, call touchTiles() after writing them between steps
+        Grid& amplitudes() {
+            return m_amplitude;
+        }
+        Grid const& amplitudes() const {
+            return m_amplitude;
+        }
+        // Node range {ix0, ix1, iy0, iy1} of the whole grid
+        std::array<int, 4> wholeGrid() const {
+            return { 0, gridDim(X), 0, gridDim(Y) };
+        }
+
+        /*
+        Runs `body(tile)` for the tiles of `range` on the executor
+        range node range {ix0, ix1, iy0, iy1}, tile a part of it
+
+        The whole grid is cut into parallelTile x parallelTile tiles handed
+        out costliest first. Nodes near the boundary pay for the levelset,
+        reflection and atan2 while land nodes are skipped, so a coastal tile
+        costs several open water ones and starting with them keeps threads
+        from finishing unevenly. Smaller ranges come from callers that spread
+        their own tiles already and run on the calling thread.
+        */
+        template <class Body>
+        void forEachTile(std::array<int, 4> range, Body const& body) const {
+            if (range != wholeGrid()) {
+                body(range);
+                return;
+            }
+
+            const int n = gridDim(X);
+            const int T = parallelTile;
+            const int nt = (n + T - 1) / T;
+            std::vector<int> const& order = tileOrder(nt);
+
+            m_executor->parallelFor(nt * nt, [&](int i) {
+                int tx = order[i] / nt;
+                int ty = order[i] % nt;
+                body(std::array<int, 4>{ tx * T, std::min(n, (tx + 1) * T), ty * T, std::min(n, (ty + 1) * T) });
+            });
+        }
+
+        /*
+        Zeroes a grid allocated with Grid::allocate(), one x-slab per thread
+
+        A node's x index is the outermost of the storage, so the slab of
+        consecutive x of one thread is one contiguous block and only the
+        pages at its two ends are shared with the neighbouring threads. Tiles
+        are too small for that: a tile row is a few hundred bytes and a 4 KB
+        page holds rows of several tiles. On NUMA systems the slabs end up
+        local to the threads of the executor that handed them out, which for
+        the row loops and a static schedule are the threads working on them.
+
+        With PlacementPolicy::huge_pages a page is 2 MB and holds the slabs
+        of several threads as soon as a slab is smaller, the first thread to
+        touch it gets all of them. Huge pages then trade the locality for
+        fewer TLB misses, which pays off on a single socket or for grids of
+        many megabytes per thread.
+        */
+        void firstTouch(Grid& grid) const {
+            forEachSlab(grid, [&](int ix0, int ix1, std::size_t row) {
+                std::fill(grid.data() + ix0 * row, grid.data() + ix1 * row, Real(0));
+            });
+        }
+        /*
+        Copies `src` into `dst`, its roll included, slab by slab like firstTouch()
+
+        `dst` is reallocated and first touched only if its size differs, a
+        plain assignment would copy and place every page on one thread.
+        */
+        void copyGrid(Grid const& src, Grid& dst) const {
+            if (dst.size() != src.size() || dst.dimension(X) != src.dimension(X) ||
+                dst.dimension(Y) != src.dimension(Y) || dst.dimension(Theta) != src.dimension(Theta)) {
+                dst.allocate(src.dimension(X), src.dimension(Y), src.dimension(Theta), src.dimension(Zeta));
+                firstTouch(dst);
+            }
+            dst.roll(src.origin()[X] - dst.origin()[X], src.origin()[Y] - dst.origin()[Y]);
+            forEachSlab(src, [&](int ix0, int ix1, std::size_t row) {
+                std::copy(src.data() + ix0 * row, src.data() + ix1 * row, dst.data() + ix0 * row);
+            });
+        }
+        // Runs body(ix0, ix1, values per x) for one range of storage x of `grid` per thread
+        template <class Body>
+        void forEachSlab(Grid const& grid, Body const& body) const {
+            const int n = grid.dimension(X);
+            const std::size_t row = std::size_t(grid.dimension(Y)) * grid.dimension(Theta) * grid.dimension(Zeta);
+            const int slabs = std::max(1, std::min(n, m_executor->concurrency()));
+            m_executor->parallelFor(slabs, [&](int i) {
+                body(int(std::int64_t(n) * i / slabs), int(std::int64_t(n) * (i + 1) / slabs), row);
+            });
+        }
+
+        /*
+        Overlaps of two partitions of one interval into `from` and `to` cells
+        Returns for every `to` cell the pairs {from cell, fraction of the to cell it covers}
+        */
+        static std::vector<std::vector<std::pair<int, Real>>> cellOverlaps(int from, int to) {
+            // in units of 1 / (from * to), cell j of `to` is [j * from, (j + 1) * from)
+            std::vector<std::vector<std::pair<int, Real>>> overlaps(to);
+            for (int j = 0; j < to; j++) {
+                for (int i = j * from / to; i < from && i * to < (j + 1) * from; i++) {
+                    int overlap = std::min((i + 1) * to, (j + 1) * from) - std::max(i * to, j * from);
+                    if (overlap > 0)
+                        overlaps[j].push_back({ i, Real(overlap) / from });
+                }
+            }
+            return overlaps;
+        }
+
+        // Sparse tile state for the current resolution, all tiles unsynced
+        void allocateTiles() {
+            if (!m_sparseTiles)
+                return;
+            const int nt = tileCount();
+            m_tileMin.resize(nt * nt * gridDim(Theta) * gridDim(Zeta));
+            m_tileMax.resize(nt * nt * gridDim(Theta) * gridDim(Zeta));
+            m_tileSynced.assign(nt * nt, false);
+            m_tileSkip.assign(nt * nt, false);
+            m_tileLand.assign(nt * nt, true);
+        }
+
+        /*
+        Brings the obstacle levelset up to date and marks the tiles it changed.
+        No pass writes land, so water an obstacle left behind starts over from
+        defaultAmplitude() instead of what it held when it was covered.
+        */
+        void updateObstacles() {
+            m_obstacles.update();
+            for (auto [ix, iy] : m_obstacles.freed()) {
+                if (!inDomain(ix, iy))
+                    continue;
+                for (int itheta = 0; itheta < gridDim(Theta); itheta++)
+                    for (int izeta = 0; izeta < gridDim(Zeta); izeta++)
+                        m_amplitude(ix, iy, itheta, izeta) = m_newAmplitude(ix, iy, itheta, izeta) =
+                            defaultAmplitude(itheta, izeta);
+            }
+            for (auto const& r : m_obstacles.dirty())
+                touchTiles(r);
+        }
+
+        /*
+        The nt x nt tiles as tx * nt + ty, costliest first
+
+        Only reads the order of the last updateTileOrder(), so the passes may
+        call it from any thread. Should the order not be for this size yet,
+        the tiles come in index order.
+        */
+        std::vector<int> const& tileOrder(int nt) const {
+            if ((int)m_tileOrder.size() != nt * nt) {
+                static thread_local std::vector<int> identity;
+                identity.resize(nt * nt);
+                std::iota(identity.begin(), identity.end(), 0);
+                return identity;
+            }
+            return m_tileOrder;
+        }
+
+        /*
+        Orders the tiles of forEachTile() by their estimated cost, costliest first
+
+        Called by the stepping thread before the passes. The costs are only
+        recomputed when the origin or the obstacles moved, one tile row per
+        executor item.
+        */
+        void updateTileOrder() {
+            const int n = gridDim(X);
+            const int T = parallelTile;
+            const int nt = (n + T - 1) / T;
+            std::array<Real, 3> key = { m_xmin[X], m_xmin[Y], Real(m_obstacles.version()) };
+            if (key == m_tileOrderKey && (int)m_tileOrder.size() == nt * nt)
+                return;
+            m_tileOrderKey = key;
+
+            std::vector<Real> cost(nt * nt, 0);
+            m_executor->parallelFor(nt, [&](int tx) {
+                for (int ix = tx * T; ix < std::min(n, (tx + 1) * T); ix++) {
+                    for (int iy = 0; iy < gridDim(Y); iy++) {
+                        Real c = 0.1f;
+                        if (inDomain(ix, iy))
+                            c = levelset(ix, iy) < 4 * dx(X) ? 4 : 1;
+                        cost[iy / T + tx * nt] += c;
+                    }
+                }
+            });
+            m_tileOrder.resize(nt * nt);
+            std::iota(m_tileOrder.begin(), m_tileOrder.end(), 0);
+            std::stable_sort(m_tileOrder.begin(), m_tileOrder.end(),
+                [&](int a, int b) { return cost[a] > cost[b]; });
+        }
+
+        // "WWCP" and the layout version, bump it whenever the layout changes
+        static constexpr std::uint32_t checkpointMagic = 0x50435757;
+        static constexpr std::uint32_t checkpointVersion = 5;
+
+        // Checkpoint block of this grid followed by those of its children
+        void writeCheckpoint(CheckpointWriter& out, bool compress) const {
+            writeSettings(out, m_settings);
+            out.put(m_enviroment.data()->fingerprint());
+            out.put(m_time);
+            out.put(m_xmin);
+            out.put(m_xmax);
+            out.putFloats(m_groupSpeeds.data(), m_groupSpeeds.size(), false);
+
+            out.put<std::uint32_t>(m_obstacles.size());
+            for (int id = 0; id < m_obstacles.size(); id++) {
+                out.put(m_obstacles.get(id));
+                out.put<std::uint8_t>(m_obstacles.active(id));
+            }
+
+            out.put(m_amplitude.origin());
+            out.putFloats(m_amplitude.data(), m_amplitude.size(), compress);
+
+            // amortized steps: the group due next and the lag of every slab
+            out.put<std::int32_t>(m_amortizedGroup);
+            out.put<std::uint32_t>(m_slabLag.size());
+            out.putFloats(m_slabLag.data(), m_slabLag.size(), false);
+
+            // view steps: the steps taken and the lag of every band of every tile, the view itself is not stored
+            out.put<std::int32_t>(m_viewStep);
+            out.put<std::uint32_t>(m_viewLag.size());
+            out.putFloats(m_viewLag.data(), m_viewLag.size(), false);
+
+            out.put<std::uint32_t>(m_children.size());
+            for (auto const& child : m_children)
+                child->writeCheckpoint(out, compress);
+        }
+
+        static std::unique_ptr<WaveGrid> readCheckpoint(CheckpointReader& in, WaveGrid const* parent) {
+            Settings s = readSettings(in);
+            std::uint32_t fingerprint = in.get<std::uint32_t>();
+            if (!in.ok() || s.n_x <= 0 || s.n_theta <= 0 || s.n_zeta <= 0)
+                return nullptr;
+            // the grid indexes with int, and the group speeds are stored raw
+            if (std::uint64_t(s.n_x) * s.n_x * s.n_theta * s.n_zeta > std::uint64_t(std::numeric_limits<int>::max()) ||
+                !in.fits(s.n_zeta, sizeof(Real))) {
+                std::cout << "ERROR::CHECKPOINT::BAD_RESOLUTION: " << s.n_x << " " << s.n_theta << " " << s.n_zeta << std::endl;
+                return nullptr;
+            }
+            if (!environments().contains(s.environment)) {
+                std::cout << "ERROR::CHECKPOINT::UNKNOWN_ENVIRONMENT: " << s.environment << std::endl;
+                return nullptr;
+            }
+
+            // the restored amplitudes replace whatever spin-up would compute
+            s.spin_up = false;
+            auto grid = parent ? std::make_unique<WaveGrid>(s, parent->m_enviroment.data()) : std::make_unique<WaveGrid>(s);
+            if (grid->m_enviroment.data()->fingerprint() != fingerprint) {
+                std::cout << "ERROR::CHECKPOINT::ENVIRONMENT_CHANGED: " << s.environment << std::endl;
+                return nullptr;
+            }
+            grid->m_parent = parent;
+            grid->m_time = in.get<Real>();
+            grid->m_xmin = in.get<std::array<Real, 4>>();
+            grid->m_xmax = in.get<std::array<Real, 4>>();
+            in.getFloats(grid->m_groupSpeeds.data(), grid->m_groupSpeeds.size());
+
+            std::uint32_t obstacles = in.get<std::uint32_t>();
+            if (!in.fits(obstacles, sizeof(Obstacle) + sizeof(std::uint8_t)))
+                return nullptr;
+            for (std::uint32_t id = 0; in.ok() && id < obstacles; id++) {
+                grid->m_obstacles.add(in.get<Obstacle>());
+                if (!in.get<std::uint8_t>())
+                    grid->m_obstacles.remove(id);
+            }
+            grid->m_obstacles.setOrigin(Vec2{ grid->m_xmin[X], grid->m_xmin[Y] });
+
+            auto origin = in.get<std::array<int, 2>>();
+            grid->m_amplitude.roll(origin[0], origin[1]);
+            grid->m_newAmplitude.roll(origin[0], origin[1]);
+            in.getFloats(grid->m_amplitude.data(), grid->m_amplitude.size());
+
+            grid->m_amortizedGroup = in.get<std::int32_t>();
+            std::uint32_t slabs = in.get<std::uint32_t>();
+            if (!in.ok() || grid->m_amortizedGroup < 0 || grid->m_amortizedGroup >= grid->m_amortizedGroups ||
+                (slabs != 0 && slabs != std::uint32_t(s.n_theta * s.n_zeta)))
+                return nullptr;
+            grid->m_slabLag.resize(slabs);
+            in.getFloats(grid->m_slabLag.data(), slabs);
+
+            const int nt = (s.n_x + parallelTile - 1) / parallelTile;
+            grid->m_viewStep = in.get<std::int32_t>();
+            std::uint32_t bands = in.get<std::uint32_t>();
+            if (!in.ok() || grid->m_viewStep < 0 ||
+                (bands != 0 && bands != std::uint32_t(nt * nt * s.n_zeta)))
+                return nullptr;
+            grid->m_viewLag.resize(bands);
+            in.getFloats(grid->m_viewLag.data(), bands);
+
+            // a child block holds at least its window
+            std::uint32_t children = in.get<std::uint32_t>();
+            if (!in.fits(children, 2 * sizeof(std::array<Real, 4>)))
+                return nullptr;
+            for (std::uint32_t i = 0; in.ok() && i < children; i++) {
+                auto child = readCheckpoint(in, grid.get());
+                if (!child)
+                    return nullptr;
+                grid->m_children.push_back(std::move(child));
+            }
+            if (!in.ok())
+                return nullptr;
+
+            grid->touchTiles(grid->wholeGrid());
+            return grid;
+        }
+
+        static void writeSettings(CheckpointWriter& out, Settings const& s) {
+            out.put(s.size);
+            out.put(s.max_zeta);
+            out.put(s.min_zeta);
+            out.put<std::int32_t>(s.n_x);
+            out.put<std::int32_t>(s.n_theta);
+            out.put<std::int32_t>(s.n_zeta);
+            out.put(s.initial_time);
+            out.put<std::int32_t>(s.sponge_width);
+            out.put(s.sponge_strength);
+            out.put<std::uint8_t>(s.periodic);
+            out.put<std::uint8_t>(s.multirate);
+            out.put<std::int32_t>(s.temporal_block);
+            out.put<std::int32_t>(s.tile_size);
+            out.put<std::uint8_t>(s.sparse_tiles);
+            out.put(s.sparse_threshold);
+            out.put<std::uint8_t>(s.spin_up);
+            out.put(s.diffusion_theta);
+            out.put<std::int32_t>(s.advection_scheme);
+            out.put<std::uint8_t>(s.cubic_advection);
+            out.put<std::uint8_t>(s.pipelined_step);
+            out.put<std::int32_t>(s.amortized_groups);
+            out.put<std::int32_t>(s.spectrumType);
+            out.putString(s.environment);
+        }
+
+        static Settings readSettings(CheckpointReader& in) {
+            Settings s;
+            s.size = in.get<Real>();
+            s.max_zeta = in.get<Real>();
+            s.min_zeta = in.get<Real>();
+            s.n_x = in.get<std::int32_t>();
+            s.n_theta = in.get<std::int32_t>();
+            s.n_zeta = in.get<std::int32_t>();
+            s.initial_time = in.get<Real>();
+            s.sponge_width = in.get<std::int32_t>();
+            s.sponge_strength = in.get<Real>();
+            s.periodic = in.get<std::uint8_t>() != 0;
+            s.multirate = in.get<std::uint8_t>() != 0;
+            s.temporal_block = in.get<std::int32_t>();
+            s.tile_size = in.get<std::int32_t>();
+            s.sparse_tiles = in.get<std::uint8_t>() != 0;
+            s.sparse_threshold = in.get<Real>();
+            s.spin_up = in.get<std::uint8_t>() != 0;
+            s.diffusion_theta = in.get<Real>();
+            s.advection_scheme = Settings::AdvectionScheme(in.get<std::int32_t>());
+            s.cubic_advection = in.get<std::uint8_t>() != 0;
+            s.pipelined_step = in.get<std::uint8_t>() != 0;
+            s.amortized_groups = in.get<std::int32_t>();
+            s.spectrumType = Settings::SpectrumType(in.get<std::int32_t>());
+            s.environment = in.getString();
+            return s;
+        }
 
     public:
         // Сֵ
         Grid     m_amplitude, m_newAmplitude;
+        // intermediate result of the MacCormack and BFECC passes
+        Grid     m_tmpAmplitude;
         // Ƶ
         Spectrum m_spectrum;
 
         //    ʵһ
-        std::vector<ProfileBuffer> m_profileBuffers;
+        // shared with all nested grids, @see shareProfileBuffers()
+        std::shared_ptr<std::vector<ProfileBuffer>> m_profileBuffers;
 
         std::array<Real, 4> m_xmin;     // -50   -50   0    -5.05889
         std::array<Real, 4> m_xmax;     // 50   50   6.28319    3.32193
@@ -606,8 +3087,80 @@ namespace WaterWavelets {
         std::vector<Real> m_groupSpeeds;
 
         Real m_time;
+        // @see revision()
+        std::uint64_t m_revision = 0;
+
+        // settings this grid was constructed with, written to checkpoints
+        Settings m_settings;
+
+        int  m_spongeWidth;
+        Real m_spongeStrength;
+
+        bool m_periodic;
+        bool m_multirate;
+        // bands the passes leave alone, set by multirateStep() for those not due in a pass
+        std::vector<char> m_bandSkip;
+        // set by viewStep(): the passes leave slabs with zero step alone instead of copying them
+        bool m_skipIdleSlabs = false;
+        int  m_temporalBlock;
+        int  m_tileSize;
+        // cached foot point reach of blockHalo(), overall and per tile, and
+        // its {dt, xmin, obstacle version}
+        std::array<Real, 4> m_blockReachKey = { -1, 0, 0, 0 };
+        int  m_blockReach = 0;
+        std::vector<int> m_tileReach;
+        // working copies of blockedSimulationSteps(), a pair per worker, dropped on resize
+        std::vector<std::array<GridTile, 2>> m_blockTiles;
+
+        // sparse tiles: amplitude range per (tile, theta, zeta) slab, tiles
+        // skipped in the current step, tiles with equal values in both
+        // amplitude buffers and tiles next to land
+        bool m_sparseTiles;
+        Real m_sparseThreshold;
+        std::vector<Real> m_tileMin, m_tileMax;
+        std::vector<char> m_tileSkip, m_tileSynced, m_tileLand;
+        std::array<Real, 3> m_tileGeometryKey = { 0, 0, -1 };
+        Real m_diffusionTheta;
+        Settings::AdvectionScheme m_advectionScheme;
+        bool m_cubicAdvection;
+
+        // Refined grids embedded in this one and the grid this one is embedded in
+        std::vector<std::unique_ptr<WaveGrid>> m_children;
+        WaveGrid const* m_parent = nullptr;
+
+        // Parent amplitudes in a ring of `ghostWidth` cells around a child
+        static constexpr int ghostWidth = 2;
+        std::vector<Real> m_ghost;
+        // the ring at the start and the end of a step of the parent, @see stepChildren()
+        std::vector<Real> m_ghostStart, m_ghostEnd;
+
+        // runs the tiles of the passes, @see forEachTile()
+        Executor* m_executor = &defaultExecutor();
+        static constexpr int parallelTile = 16;
+        // tile order of forEachTile() and the {xmin, ymin, obstacle version} it is for
+        std::vector<int> m_tileOrder;
+        std::array<Real, 3> m_tileOrderKey = { 0, 0, -1 };
+
+        // pipelinedStep() instead of the passes, its task graph and tile callback
+        bool m_pipelined;
+        TaskGraph m_stepGraph;
+        std::function<void(Grid const&, std::array<int, 4>)> m_tileStepped;
+
+        // amortizedDt(): number of groups, the group due next and the time every slab lags behind
+        int m_amortizedGroups;
+        int m_amortizedGroup = 0;
+        std::vector<Real> m_slabLag;
+
+        // setView(): the camera, whether it is set, the steps taken and the time every band of every tile lags behind
+        View m_view;
+        bool m_viewSet = false;
+        int m_viewStep = 0;
+        std::vector<Real> m_viewLag;
+        // band steps of every tile in the current view step, @see viewDt()
+        std::vector<std::vector<Real>> m_viewDt;
 
         Environment m_enviroment;
+        ObstacleLayer m_obstacles;
     };
 
 } // namespace WaterWavelets
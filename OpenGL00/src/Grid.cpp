@@ -1,35 +1,51 @@
+#include <algorithm>
 #include <cassert>
 #include "../include/Grid.h"
 
 namespace WaterWavelets 
 {
 	// ޲ι
-	Grid::Grid() :m_dimensions{ 0,0,0,0 }, m_data{ 0 } {}
+	Grid::Grid() :m_dimensions{ 0,0,0,0 }, m_data{ 0 }, m_origin{ 0,0 } {}
 
 	// С
 	void Grid::resize(int n0,int n1,int n2,int n3) {
+		allocate(n0, n1, n2, n3);
+		std::fill(m_data.begin(), m_data.end(), Real(0));
+	}
+
+	void Grid::allocate(int n0, int n1, int n2, int n3) {
 		// 0123 ֱ ÿϵά
 		m_dimensions = std::array<int, 4>{n0, n1, n2, n3};
+		m_origin = { 0, 0 };
 		m_data.resize(n0 * n1 * n2 * n3);
 	}
 
-	// ȡԪֵ
-	Real& Grid::operator()(int i0, int i1, int i2, int i3) {
-		assert(i0 >= 0 && i0 < dimension(0) && i1 >= 0 && i1 < dimension(1) &&
-			i2 >= 0 && i2 < dimension(2) && i3 >= 0 && i3 < dimension(3));
-		
-		return m_data[i3 + dimension(3) * (i2 + dimension(2) * (i1 + dimension(1) * i0))];
+	void Grid::roll(int s0, int s1)
+	{
+		// nothing to shift, and the modulo below would divide by zero
+		if (dimension(0) == 0 || dimension(1) == 0)
+			return;
+		m_origin[0] = ((m_origin[0] + s0) % dimension(0) + dimension(0)) % dimension(0);
+		m_origin[1] = ((m_origin[1] + s1) % dimension(1) + dimension(1)) % dimension(1);
+	}
+
+	Real* Grid::data()
+	{
+		return m_data.data();
+	}
+
+	Real const* Grid::data()const
+	{
+		return m_data.data();
 	}
 
-	Real const& Grid::operator()(int i0, int i1, int i2, int i3)const 
+	int Grid::size()const
 	{
-		return m_data[i3 +
-			dimension(3) * (i2 + dimension(2) * (i1 + dimension(1) * i0))];
+		return m_data.size();
 	}
 
-	// صdimά
-	int Grid::dimension(int dim)const 
+	std::array<int, 2> Grid::origin()const
 	{
-		return m_dimensions[dim];
+		return m_origin;
 	}
 }
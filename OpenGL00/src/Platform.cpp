@@ -0,0 +1,55 @@
+#include "../include/Platform.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+namespace WaterWavelets
+{
+	static std::size_t alignmentOf(std::size_t bytes)
+	{
+		return bytes >= hugePageSize ? hugePageSize : cacheLineSize;
+	}
+
+	void* allocateAligned(std::size_t bytes)
+	{
+		void* p = ::operator new(bytes, std::align_val_t(alignmentOf(bytes)));
+#if defined(__linux__)
+		// whole huge pages of the block only, the advice is a hint anyway
+		if (placementPolicy().huge_pages && bytes >= hugePageSize)
+			madvise(p, bytes / hugePageSize * hugePageSize, MADV_HUGEPAGE);
+#endif
+		return p;
+	}
+
+	void freeAligned(void* p, std::size_t bytes)
+	{
+		::operator delete(p, std::align_val_t(alignmentOf(bytes)));
+	}
+
+	bool pinCurrentThread(int cpu)
+	{
+		if (cpu < 0)
+			return false;
+#if defined(_WIN32)
+		if (cpu >= 64)
+			return false;
+		return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#elif defined(__linux__)
+		if (cpu >= CPU_SETSIZE)
+			return false;
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+		return false;
+#endif
+	}
+}
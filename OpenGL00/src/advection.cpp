@@ -0,0 +1,92 @@
+// Error versus cost of the advection schemes, see Settings::advection_scheme
+//
+// A Gaussian packet (sigma 5) in one direction is advected 40 units on open
+// water with advection steps only, so the exact solution is the shifted
+// packet. Every scheme and resolution prints the relative L2 error of that
+// direction against the exact solution and the time of the steps.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../include/WaveGrid.h"
+
+using namespace WaterWavelets;
+
+namespace
+{
+    struct Scheme {
+        const char* name;
+        WaveGrid::Settings::AdvectionScheme scheme;
+        bool cubic;
+    };
+}
+
+int main()
+{
+    environments().add("open water", [] { return std::vector<float>(64 * 64, 1000.f); });
+
+    const Scheme schemes[] = {
+        { "SL linear", WaveGrid::Settings::SemiLagrangian, false },
+        { "SL cubic", WaveGrid::Settings::SemiLagrangian, true },
+        { "MacCormack", WaveGrid::Settings::MacCormack, false },
+        { "BFECC", WaveGrid::Settings::BFECC, false },
+        { "MacCormack cubic", WaveGrid::Settings::MacCormack, true },
+    };
+    const int direction = 1;
+    const Real sigma = 5;
+    const Real distance = 40;
+
+    for (int n : { 25, 50, 100 }) {
+        for (Scheme const& scheme : schemes) {
+            WaveGrid::Settings s;
+            s.environment = "open water";
+            s.size = 50;
+            s.n_x = n;
+            s.n_theta = 8;
+            s.n_zeta = 1;
+            s.advection_scheme = scheme.scheme;
+            s.cubic_advection = scheme.cubic;
+
+            // the grid constructor reports on std::cout
+            std::cout.setstate(std::ios::failbit);
+            WaveGrid grid(s);
+            std::cout.clear();
+
+            const Vec2 velocity = grid.groupVelocity(grid.idxToPos({ 0, 0, direction, 0 }));
+            const Real duration = distance / norm(velocity);
+            auto exact = [&](Vec2 pos, Real t) {
+                Vec2 center = { -20 + velocity[0] * t, -20 + velocity[1] * t };
+                Vec2 d = pos - center;
+                return std::exp(-(d * d) / (2 * sigma * sigma));
+            };
+
+            for (int ix = 0; ix < n; ix++)
+                for (int iy = 0; iy < n; iy++)
+                    for (int itheta = 0; itheta < s.n_theta; itheta++)
+                        grid.m_amplitude(ix, iy, itheta, 0) = itheta == direction ? exact(grid.nodePosition(ix, iy), 0) : 0;
+
+            const int steps = (int)std::ceil(duration / std::min(grid.cflTimeStep(), Real(1)));
+            const Real dt = duration / steps;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < steps; i++)
+                grid.advectionStep(dt);
+            std::chrono::duration<double, std::milli> ms = std::chrono::steady_clock::now() - start;
+
+            double error2 = 0, norm2 = 0;
+            for (int ix = 0; ix < n; ix++)
+                for (int iy = 0; iy < n; iy++) {
+                    double x = exact(grid.nodePosition(ix, iy), duration);
+                    double d = grid.m_amplitude(ix, iy, direction, 0) - x;
+                    error2 += d * d;
+                    norm2 += x * x;
+                }
+
+            std::cout << "n_x " << n << " " << scheme.name << ": rel. L2 " << std::sqrt(error2 / norm2)
+                << ", " << steps << " steps in " << ms.count() << " ms" << std::endl;
+        }
+    }
+    return 0;
+}
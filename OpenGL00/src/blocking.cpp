@@ -0,0 +1,91 @@
+// Checks temporally blocked steps against single steps, see WaveGrid::blockedSimulationSteps()
+//
+// Every configuration runs `count` steps once in blocks of k steps and once
+// step by step from the same start, and prints the largest and the relative
+// L2 difference of the amplitudes in the domain together with the time of
+// both runs. The blocked run matches up to the round-off of the order of
+// operations. The island map keeps most tiles in open water, around the rough
+// coast of the harbor the halos cover the grid and the steps fall back to
+// single ones.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "../include/WaveGrid.h"
+
+using namespace WaterWavelets;
+
+namespace
+{
+    struct Run {
+        double seconds;
+        std::unique_ptr<WaveGrid> grid;
+    };
+
+    Run run(WaveGrid::Settings s, int k, int count) {
+        s.temporal_block = k;
+        auto grid = std::make_unique<WaveGrid>(s);
+        grid->addPointDisturbance({ -10, 5 }, 1);
+        grid->addPointDisturbance({ 12, -8 }, 0.5);
+        const Real dt = grid->cflTimeStep();
+
+        auto start = std::chrono::steady_clock::now();
+        grid->timeSteps(dt, count);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+        return { seconds.count(), std::move(grid) };
+    }
+}
+
+int main()
+{
+    const int count = 16;
+
+    for (int cubic = 0; cubic < 2; cubic++) {
+        for (int implicitDiffusion = 0; implicitDiffusion < 2; implicitDiffusion++) {
+            WaveGrid::Settings s;
+            s.n_x = 128;
+            s.n_theta = 16;
+            s.n_zeta = 2;
+            s.tile_size = 16;
+            s.environment = "island";
+            s.cubic_advection = cubic;
+            s.diffusion_theta = implicitDiffusion ? 0.5f : 0;
+
+            // the grid constructor reports on std::cout
+            std::cout.setstate(std::ios::failbit);
+            Run single = run(s, 1, count);
+            std::cout.clear();
+
+            for (int k : { 2, 4, 8 }) {
+                std::cout.setstate(std::ios::failbit);
+                Run blocked = run(s, k, count);
+                std::cout.clear();
+
+                double maxDiff = 0, diff2 = 0, norm2 = 0;
+                WaveGrid const& a = *single.grid;
+                WaveGrid const& b = *blocked.grid;
+                for (int ix = 0; ix < a.gridDim(WaveGrid::X); ix++) {
+                    for (int iy = 0; iy < a.gridDim(WaveGrid::Y); iy++) {
+                        // nodes on land are not simulated
+                        if (!a.inDomain(ix, iy))
+                            continue;
+                        for (int itheta = 0; itheta < a.gridDim(WaveGrid::Theta); itheta++)
+                            for (int izeta = 0; izeta < a.gridDim(WaveGrid::Zeta); izeta++) {
+                                double x = a.m_amplitude(ix, iy, itheta, izeta);
+                                double d = b.m_amplitude(ix, iy, itheta, izeta) - x;
+                                maxDiff = std::max(maxDiff, std::abs(d));
+                                diff2 += d * d;
+                                norm2 += x * x;
+                            }
+                    }
+                }
+
+                std::cout << (cubic ? "cubic" : "linear") << (implicitDiffusion ? " implicit" : " explicit")
+                    << " k " << k << ": max diff " << maxDiff << ", rel. L2 " << std::sqrt(diff2 / norm2)
+                    << ", " << blocked.seconds << " s blocked, " << single.seconds << " s single" << std::endl;
+            }
+        }
+    }
+    return 0;
+}
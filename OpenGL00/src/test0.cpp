@@ -16,6 +16,7 @@
 
 #include "../include/PlaneMesh.h"
 #include "../include/WaveGrid.h"
+#include "../include/SnapshotPublisher.h"
 
 using namespace WaterWavelets;
 
@@ -97,10 +98,11 @@ int main()
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init("#version 330");
     WaveGrid _waveGrid(settings);
+    SnapshotPublisher _publisher(_waveGrid);
     PlaneMesh plane(10, 10);
 
     // һάͼ
-    plane.testTex(_waveGrid.m_profileBuffers[0]);
+    plane.testTex((*_publisher.latest().m_profileBuffers)[0]);
     
     // 
     //glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);